@@ -21,7 +21,9 @@
  */
 static int sim_status_check_handle(const struct cat_variable* var, const size_t write_size)
 {
-    if (strnstr(var->data, "READY", write_size) != NULL)
+    (void) write_size;
+
+    if (strstr((const char*) var->data, "READY") != NULL)
     {
         log_i("SIM card is ready\r\n");
     }
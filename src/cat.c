@@ -28,6 +28,19 @@ SOFTWARE.
 #include <stdio.h>
 #include <string.h>
 
+#if !defined(CAT_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#include <emmintrin.h>
+#define CAT_SIMD_SSE2
+#elif !defined(CAT_NO_SIMD) && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define CAT_SIMD_NEON
+#endif
+
+#ifdef CAT_RX_RING_ATOMICS
+/* ring indexes are seen as plain size_t by c++ applications, atomic object has to have the same representation */
+_Static_assert(sizeof(atomic_size_t) == sizeof(size_t), "atomic_size_t has to have size_t representation");
+#endif
+
 // NOLINTBEGIN
 
 // 如果不是标准 glibc 环境，就自定义 assert
@@ -54,13 +67,18 @@ void my_assert_handler(const char* file, int line, const char* func, const char*
 #define CAT_WRITE_STATE_MAIN_BUFFER (1U)
 #define CAT_WRITE_STATE_AFTER (2U)
 
+#define CAT_PARSE_ARG_MORE (2)
+
 static inline char* get_atcmd_buf(struct cat_object* self)
 {
-    return (char*) self->desc->buf;
+    return (self->atcmd_buf_index != 0) ? (char*) self->desc->atcmd_buf2 : (char*) self->desc->buf;
 }
 
 static inline size_t get_atcmd_buf_size(struct cat_object* self)
 {
+    if (self->atcmd_buf_index != 0)
+        return self->desc->atcmd_buf2_size;
+
     return (self->desc->unsolicited_buf != NULL) ? self->desc->buf_size : self->desc->buf_size >> 1;
 }
 
@@ -107,7 +125,7 @@ static void unsolicited_reset_state(struct cat_object* self)
 
 static cat_status is_busy(struct cat_object* self)
 {
-    return (self->state != CAT_STATE_IDLE) ? CAT_STATUS_BUSY : CAT_STATUS_OK;
+    return ((self->state != CAT_STATE_IDLE) || (self->flush_pending != false)) ? CAT_STATUS_BUSY : CAT_STATUS_OK;
 }
 
 cat_status cat_is_busy(struct cat_object* self)
@@ -173,6 +191,20 @@ static bool is_variables_access_possible(struct cat_object* self, const struct c
     return ok;
 }
 
+static bool is_write_args_possible(struct cat_object* self, const struct cat_command* cmd)
+{
+    return (cmd->repeat_var_num > 0) || (is_variables_access_possible(self, cmd, CAT_VAR_ACCESS_WRITE_ONLY) != false);
+}
+
+/* variables with index above var_num are taken cyclically from repeated element variables */
+static struct cat_variable const* get_write_var(struct cat_command const* cmd, size_t index)
+{
+    if (index < cmd->var_num)
+        return &cmd->var[index];
+
+    return &cmd->repeat_var[(index - cmd->var_num) % cmd->repeat_var_num];
+}
+
 static bool is_unsolicited_buffer_full(struct cat_object* self)
 {
     assert(self != NULL);
@@ -312,15 +344,22 @@ static const char* get_new_line_chars(struct cat_object* self)
     return &crlf[(self->cr_flag != false) ? 0 : 1];
 }
 
+static void start_write_wait(struct cat_object* self, cat_fsm_type fsm)
+{
+    self->write_wait_step[fsm] = self->steps;
+    self->write_wait_ms[fsm]   = self->now_ms;
+}
+
 static void start_flush_io_buffer(struct cat_object* self, cat_state state_after)
 {
     assert(self != NULL);
 
     self->position          = 0;
-    self->write_buf         = get_new_line_chars(self);
-    self->write_state       = CAT_WRITE_STATE_BEFORE;
+    self->write_raw         = false;
     self->write_state_after = state_after;
     self->state             = CAT_STATE_FLUSH_IO_WRITE_WAIT;
+
+    start_write_wait(self, CAT_FSM_TYPE_ATCMD);
 }
 
 static void unsolicited_start_flush_io_buffer(struct cat_object* self, cat_unsolicited_state state_after)
@@ -332,6 +371,8 @@ static void unsolicited_start_flush_io_buffer(struct cat_object* self, cat_unsol
     self->unsolicited_fsm.write_state       = CAT_WRITE_STATE_BEFORE;
     self->unsolicited_fsm.write_state_after = state_after;
     self->unsolicited_fsm.state             = CAT_UNSOLICITED_STATE_FLUSH_IO_WRITE_WAIT;
+
+    start_write_wait(self, CAT_FSM_TYPE_UNSOLICITED);
 }
 
 static void start_flush_io_buffer_raw(struct cat_object* self, cat_state state_after)
@@ -339,10 +380,11 @@ static void start_flush_io_buffer_raw(struct cat_object* self, cat_state state_a
     assert(self != NULL);
 
     self->position          = 0;
-    self->write_buf         = get_atcmd_buf(self);
-    self->write_state       = CAT_WRITE_STATE_AFTER;
+    self->write_raw         = true;
     self->write_state_after = state_after;
     self->state             = CAT_STATE_FLUSH_IO_WRITE_WAIT;
+
+    start_write_wait(self, CAT_FSM_TYPE_ATCMD);
 }
 
 static void ack_error(struct cat_object* self)
@@ -434,12 +476,40 @@ static int print_string_to_buf(struct cat_object* self, const char* str, cat_fsm
     return print_nstring_to_buf(self, str, strlen(str), fsm);
 }
 
+static void notify(struct cat_object* self)
+{
+    if (self->notify_handler != NULL)
+        self->notify_handler();
+}
+
+static int read_char(struct cat_object* self)
+{
+    if (self->feed_data != NULL)
+    {
+        if (self->feed_position >= self->feed_size)
+            return 0;
+
+        self->current_char = (char) self->feed_data[self->feed_position++];
+        self->last_char_ms = self->now_ms;
+        return 1;
+    }
+
+    if ((self->io->read == NULL) || (self->io->read(&self->current_char) == 0))
+        return 0;
+
+    self->last_char_ms = self->now_ms;
+    return 1;
+}
+
 static int read_cmd_char(struct cat_object* self)
 {
     assert(self != NULL);
 
-    if (self->io->read(&self->current_char) == 0)
+    if (read_char(self) == 0)
+    {
+        self->input_starved = true;
         return 0;
+    }
 
     if (self->state != CAT_STATE_PARSE_COMMAND_ARGS)
         self->current_char = to_upper(self->current_char);
@@ -455,6 +525,9 @@ static struct cat_command const* get_command_by_index(struct cat_object* self, s
     assert(self != NULL);
     assert(index < self->commands_num);
 
+    if (self->cmd_index != NULL)
+        return self->cmd_index[index].cmd;
+
     j = 0;
     for (i = 0; i < self->desc->cmd_group_num; i++)
     {
@@ -472,6 +545,301 @@ static struct cat_command const* get_command_by_index(struct cat_object* self, s
     return NULL;
 }
 
+static void cmd_index_init(struct cat_object* self)
+{
+    size_t                          i, j, k;
+    struct cat_command_group const* cmd_group;
+    struct cat_command_index*       cmd_index = self->desc->cmd_index;
+
+    assert(self->desc->cmd_group_num <= UINT16_MAX);
+
+    k = 0;
+    for (i = 0; i < self->desc->cmd_group_num; i++)
+    {
+        cmd_group = self->desc->cmd_group[i];
+
+        for (j = 0; j < cmd_group->cmd_num; j++)
+        {
+            cmd_index[k].cmd   = &cmd_group->cmd[j];
+            cmd_index[k].group = (uint16_t) i;
+            k++;
+        }
+    }
+}
+
+static int compare_cmd_names(const char* a, const char* b)
+{
+    while ((*a != '\0') && (to_upper(*a) == to_upper(*b)))
+    {
+        a++;
+        b++;
+    }
+
+    return (int) (uint8_t) to_upper(*a) - (int) (uint8_t) to_upper(*b);
+}
+
+static void trie_sort_commands(struct cat_object* self)
+{
+    size_t    i, j;
+    uint16_t  index;
+    uint16_t* order = self->desc->trie_order;
+
+    for (i = 0; i < self->commands_num; i++)
+    {
+        index = (uint16_t) i;
+        j     = i;
+        while ((j > 0) && (compare_cmd_names(get_command_by_index(self, order[j - 1])->name, get_command_by_index(self, index)->name) > 0))
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = index;
+    }
+}
+
+static void trie_init(struct cat_object* self)
+{
+    size_t                i, k, node, child, prev, nodes_num;
+    const char*           name;
+    char                  ch;
+    struct cat_trie_node* trie  = self->desc->trie;
+    uint16_t const*       order = self->desc->trie_order;
+
+    assert(order != NULL);
+    assert(self->desc->trie_size > 0);
+    assert(self->commands_num <= UINT16_MAX);
+
+    trie_sort_commands(self);
+
+    trie[0].child   = 0;
+    trie[0].sibling = 0;
+    trie[0].begin   = 0;
+    trie[0].end     = (uint16_t) self->commands_num;
+    trie[0].ch      = '\0';
+    nodes_num       = 1;
+
+    /* commands are sorted, so every name prefix covers continuous range of sorted order */
+    /* and new child nodes are always appended at the end of siblings list */
+    for (i = 0; i < self->commands_num; i++)
+    {
+        name = get_command_by_index(self, order[i])->name;
+        node = 0;
+
+        for (k = 0; name[k] != '\0'; k++)
+        {
+            ch    = to_upper(name[k]);
+            prev  = 0;
+            child = trie[node].child;
+            while ((child != 0) && (trie[child].ch != ch))
+            {
+                prev  = child;
+                child = trie[child].sibling;
+            }
+
+            if (child == 0)
+            {
+                assert(nodes_num < self->desc->trie_size);
+                assert(nodes_num <= UINT16_MAX);
+
+                child               = nodes_num++;
+                trie[child].child   = 0;
+                trie[child].sibling = 0;
+                trie[child].begin   = (uint16_t) i;
+                trie[child].ch      = ch;
+
+                if (prev == 0)
+                {
+                    trie[node].child = (uint16_t) child;
+                }
+                else
+                {
+                    trie[prev].sibling = (uint16_t) child;
+                }
+            }
+
+            trie[child].end = (uint16_t) (i + 1);
+            node            = child;
+        }
+    }
+}
+
+/* FNV-1a hash of names (same function is used by catgen for prebuilt tables) */
+static uint32_t hash_nname(const char* name, size_t len, uint32_t seed)
+{
+    uint32_t h = 2166136261U ^ seed;
+
+    while (len-- > 0)
+    {
+        h ^= (uint8_t) *name++;
+        h *= 16777619U;
+    }
+
+    return h;
+}
+
+static uint32_t hash_name(const char* name, uint32_t seed)
+{
+    return hash_nname(name, strlen(name), seed);
+}
+
+static uint32_t hash_var_name(struct cat_command const* cmd, const char* name, uint32_t seed)
+{
+    return hash_name(name, seed ^ (uint32_t) (uintptr_t) cmd);
+}
+
+static void hash_table_init(struct cat_hash_table* hash, uint16_t** arena, size_t* arena_left, size_t items_num)
+{
+    size_t size;
+
+    hash->slots = NULL;
+    hash->size  = 0;
+    hash->seed  = 0;
+
+    if (items_num == 0)
+        return;
+
+    assert(items_num < UINT16_MAX);
+
+    size = 1;
+    while (size < items_num * 2)
+        size <<= 1;
+
+    assert(size <= *arena_left);
+
+    memset(*arena, 0, size * sizeof(uint16_t));
+    hash->slots = *arena;
+    hash->size  = size;
+
+    *arena += size;
+    *arena_left -= size;
+}
+
+static void hash_table_insert(struct cat_hash_table* hash, uint32_t h, size_t item)
+{
+    size_t    slot;
+    uint16_t* slots = (uint16_t*) hash->slots;
+
+    slot = h & (hash->size - 1);
+    while (slots[slot] != 0)
+        slot = (slot + 1) & (hash->size - 1);
+
+    slots[slot] = (uint16_t) (item + 1);
+}
+
+static bool is_keyword_equal(const char* keyword, const char* token, size_t len)
+{
+    return (strncmp(keyword, token, len) == 0) && (keyword[len] == '\0');
+}
+
+static int find_enum_keyword(struct cat_enum const* keywords, const char* token, size_t len, size_t* index)
+{
+    size_t                       i, slot;
+    struct cat_hash_table const* hash = &keywords->hash;
+
+    assert(keywords != NULL);
+
+    if (hash->slots != NULL)
+    {
+        slot = hash_nname(token, len, hash->seed) & (hash->size - 1);
+        for (i = 0; i < hash->size; i++)
+        {
+            if (hash->slots[slot] == 0)
+                break;
+
+            if (is_keyword_equal(keywords->names[hash->slots[slot] - 1U], token, len) != false)
+            {
+                *index = hash->slots[slot] - 1U;
+                return 0;
+            }
+
+            slot = (slot + 1) & (hash->size - 1);
+        }
+        return -1;
+    }
+
+    for (i = 0; i < keywords->num; i++)
+    {
+        if (is_keyword_equal(keywords->names[i], token, len) != false)
+        {
+            *index = i;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+void cat_enum_hash_init(struct cat_enum* keywords, uint16_t* slots, size_t slots_num)
+{
+    size_t i;
+
+    assert(keywords != NULL);
+    assert(slots != NULL);
+
+    hash_table_init(&keywords->hash, &slots, &slots_num, keywords->num);
+    for (i = 0; i < keywords->num; i++)
+        hash_table_insert(&keywords->hash, hash_name(keywords->names[i], keywords->hash.seed), i);
+}
+
+static void hash_init(struct cat_object* self)
+{
+    size_t                          i, j, groups_num, vars_num;
+    struct cat_command const*       cmd;
+    struct cat_command_group const* cmd_group;
+    uint16_t*                       arena      = self->desc->hash_arena;
+    size_t                          arena_left = self->desc->hash_arena_size;
+
+    self->cmd_hash   = self->desc->cmd_hash;
+    self->group_hash = (struct cat_hash_table) {0};
+    self->var_hash   = (struct cat_hash_table) {0};
+
+    if (arena == NULL)
+        return;
+
+    if (self->cmd_hash.slots == NULL)
+    {
+        hash_table_init(&self->cmd_hash, &arena, &arena_left, self->commands_num);
+        for (i = 0; i < self->commands_num; i++)
+            hash_table_insert(&self->cmd_hash, hash_name(get_command_by_index(self, i)->name, self->cmd_hash.seed), i);
+    }
+
+    groups_num = 0;
+    for (i = 0; i < self->desc->cmd_group_num; i++)
+    {
+        if (self->desc->cmd_group[i]->name != NULL)
+            groups_num++;
+    }
+
+    hash_table_init(&self->group_hash, &arena, &arena_left, groups_num);
+    for (i = 0; i < self->desc->cmd_group_num; i++)
+    {
+        cmd_group = self->desc->cmd_group[i];
+        if (cmd_group->name != NULL)
+            hash_table_insert(&self->group_hash, hash_name(cmd_group->name, self->group_hash.seed), i);
+    }
+
+    vars_num = 0;
+    for (i = 0; i < self->commands_num; i++)
+    {
+        cmd = get_command_by_index(self, i);
+        for (j = 0; j < cmd->var_num; j++)
+        {
+            if (cmd->var[j].name != NULL)
+                vars_num++;
+        }
+    }
+
+    hash_table_init(&self->var_hash, &arena, &arena_left, vars_num);
+    for (i = 0; i < self->commands_num; i++)
+    {
+        cmd = get_command_by_index(self, i);
+        for (j = 0; j < cmd->var_num; j++)
+        {
+            if (cmd->var[j].name != NULL)
+                hash_table_insert(&self->var_hash, hash_var_name(cmd, cmd->var[j].name, self->var_hash.seed), j);
+        }
+    }
+}
+
 static void unsolicited_init(struct cat_object* self)
 {
     self->unsolicited_fsm.unsolicited_cmd_buffer_tail        = 0;
@@ -512,11 +880,35 @@ void cat_init(struct cat_object* self, const struct cat_descriptor* desc, const
                 assert(cmd_group->cmd[j].run == NULL);
                 assert(cmd_group->cmd[j].test == NULL);
             }
+            assert((cmd_group->cmd[j].repeat_var_num == 0) || (cmd_group->cmd[j].repeat_var != NULL));
+            if (cmd_group->cmd[j].capture_ring != NULL)
+            {
+                assert(cmd_group->cmd[j].capture_var < cmd_group->cmd[j].var_num);
+                assert((cmd_group->cmd[j].var[cmd_group->cmd[j].capture_var].type == CAT_VAR_UINT_DEC) ||
+                       (cmd_group->cmd[j].var[cmd_group->cmd[j].capture_var].type == CAT_VAR_NUM_HEX));
+                assert(cmd_group->cmd[j].var[cmd_group->cmd[j].capture_var].access != CAT_VAR_ACCESS_READ_ONLY);
+            }
         }
     }
 
     assert(desc->buf != NULL);
-    assert(desc->buf_size * 4U >= self->commands_num);
+    assert((desc->tx_ring == NULL) || (desc->tx_ring_size >= 2U));
+    if (desc->tables_prebuilt != false)
+    {
+        self->trie       = desc->prebuilt_trie;
+        self->trie_order = desc->prebuilt_trie_order;
+        self->cmd_index  = desc->prebuilt_cmd_index;
+    }
+    else
+    {
+        self->trie       = desc->trie;
+        self->trie_order = desc->trie_order;
+        self->cmd_index  = desc->cmd_index;
+    }
+
+    assert((self->trie == NULL) || (self->trie_order != NULL));
+    assert((self->trie != NULL) || (desc->buf_size * 4U >= self->commands_num));
+    assert((desc->atcmd_buf2 == NULL) || (self->trie != NULL) || (desc->atcmd_buf2_size * 4U >= self->commands_num));
 
     self->desc                = desc;
     self->io                  = io;
@@ -524,6 +916,47 @@ void cat_init(struct cat_object* self, const struct cat_descriptor* desc, const
     self->hold_state_flag     = false;
     self->hold_exit_status    = 0;
     self->implicit_write_flag = false;
+    self->trie_node           = 0;
+    self->feed_data           = NULL;
+    self->feed_size           = 0;
+    self->feed_position       = 0;
+    self->input_starved       = false;
+    self->output_blocked      = false;
+    self->capture_full        = false;
+    self->prompt_handler      = NULL;
+    self->notify_handler      = NULL;
+    self->wait_reason         = CAT_STOP_REASON_IDLE;
+    self->now_ms              = 0;
+    self->last_char_ms        = 0;
+    self->hold_start_ms       = 0;
+    self->hold_timeout_ms     = 0;
+    self->atcmd_buf_index     = 0;
+    self->flush_pending       = false;
+    self->flush_ok            = false;
+    self->write_raw           = false;
+    self->write_position      = 0;
+    self->steps               = 0;
+    self->tx_head             = 0;
+    self->tx_tail             = 0;
+    self->tx_len              = 0;
+    self->stream_args_flag    = false;
+    self->data_phase_flag     = false;
+    self->capture_left        = 0;
+
+    memset(self->write_wait_step, 0, sizeof(self->write_wait_step));
+    memset(self->write_wait_ms, 0, sizeof(self->write_wait_ms));
+    memset(self->write_stats, 0, sizeof(self->write_stats));
+
+    if (desc->tables_prebuilt == false)
+    {
+        if (self->cmd_index != NULL)
+            cmd_index_init(self);
+
+        if (self->trie != NULL)
+            trie_init(self);
+    }
+
+    hash_init(self);
 
     reset_state(self);
 
@@ -557,11 +990,13 @@ static void prepare_parse_command(struct cat_object* self)
 
     assert(self != NULL);
 
-    memset(get_atcmd_buf(self), val, get_atcmd_buf_size(self));
+    if (self->trie == NULL)
+        memset(get_atcmd_buf(self), val, get_atcmd_buf_size(self));
 
-    self->index    = 0;
-    self->length   = 0;
-    self->cmd_type = CAT_CMD_TYPE_RUN;
+    self->index     = 0;
+    self->length    = 0;
+    self->trie_node = 0;
+    self->cmd_type  = CAT_CMD_TYPE_RUN;
 }
 
 static cat_status parse_prefix(struct cat_object* self)
@@ -620,66 +1055,500 @@ static uint8_t convert_hex_char_to_value(const char ch)
     return ((ch >= '0') && (ch <= '9')) ? (uint8_t) (ch - '0') : (uint8_t) (ch - 'A' + 10U);
 }
 
-static void end_processing_with_error(struct cat_object* self, cat_fsm_type fsm)
+static const char hex_digits[] = "0123456789ABCDEF";
+
+/* value of hex char plus one (0 - not hex char) */
+static const uint8_t hex_values[256] = {
+    ['0'] = 1,  ['1'] = 2,  ['2'] = 3,  ['3'] = 4,  ['4'] = 5,  ['5'] = 6,  ['6'] = 7,  ['7'] = 8,
+    ['8'] = 9,  ['9'] = 10, ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+    ['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16,
+};
+
+static void encode_hex(char* dst, const uint8_t* src, size_t n)
 {
-    assert(self != NULL);
-    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+    size_t i = 0;
 
-    switch (fsm)
+#ifdef CAT_SIMD_SSE2
+    const __m128i mask         = _mm_set1_epi8(0x0F);
+    const __m128i nine         = _mm_set1_epi8(9);
+    const __m128i digit_offset = _mm_set1_epi8('0');
+    const __m128i alpha_offset = _mm_set1_epi8('A' - '0' - 10);
+    __m128i       b, hi, lo;
+
+    for (; (i + 16U) <= n; i += 16U)
     {
-    case CAT_FSM_TYPE_ATCMD:
-        ack_error(self);
-        break;
-    case CAT_FSM_TYPE_UNSOLICITED:
-        unsolicited_reset_state(self);
-        break;
-    default:
-        assert(false);
+        b  = _mm_loadu_si128((const __m128i*) &src[i]);
+        hi = _mm_and_si128(_mm_srli_epi16(b, 4), mask);
+        lo = _mm_and_si128(b, mask);
+
+        b  = _mm_unpacklo_epi8(hi, lo);
+        hi = _mm_unpackhi_epi8(hi, lo);
+        b  = _mm_add_epi8(_mm_add_epi8(b, digit_offset), _mm_and_si128(_mm_cmpgt_epi8(b, nine), alpha_offset));
+        hi = _mm_add_epi8(_mm_add_epi8(hi, digit_offset), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), alpha_offset));
+
+        _mm_storeu_si128((__m128i*) &dst[2U * i], b);
+        _mm_storeu_si128((__m128i*) &dst[2U * i + 16U], hi);
     }
-}
+#elif defined(CAT_SIMD_NEON)
+    const uint8x16_t digits = vld1q_u8((const uint8_t*) hex_digits);
+    uint8x16_t       b;
+    uint8x16x2_t     d;
 
-static void end_processing_with_ok(struct cat_object* self, cat_fsm_type fsm)
-{
-    assert(self != NULL);
-    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+    for (; (i + 16U) <= n; i += 16U)
+    {
+        b = vld1q_u8(&src[i]);
+        d = vzipq_u8(vqtbl1q_u8(digits, vshrq_n_u8(b, 4)), vqtbl1q_u8(digits, vandq_u8(b, vdupq_n_u8(0x0F))));
 
-    switch (fsm)
+        vst1q_u8((uint8_t*) &dst[2U * i], d.val[0]);
+        vst1q_u8((uint8_t*) &dst[2U * i + 16U], d.val[1]);
+    }
+#endif
+
+    for (; i < n; i++)
     {
-    case CAT_FSM_TYPE_ATCMD:
-        ack_ok(self);
-        break;
-    case CAT_FSM_TYPE_UNSOLICITED:
-        unsolicited_reset_state(self);
-        break;
-    default:
-        assert(false);
+        dst[2U * i]      = hex_digits[src[i] >> 4];
+        dst[2U * i + 1U] = hex_digits[src[i] & 0x0FU];
     }
 }
 
-static void reset_position(struct cat_object* self, cat_fsm_type fsm)
+/* decodes up to n bytes from pairs of hex chars, stops at first pair with not hex char */
+static size_t decode_hex(uint8_t* dst, const char* src, size_t n)
 {
-    assert(self != NULL);
-    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+    size_t  i = 0;
+    uint8_t hi, lo;
 
-    switch (fsm)
+#ifdef CAT_SIMD_SSE2
+    const __m128i case_bit     = _mm_set1_epi8(0x20);
+    const __m128i alpha_offset = _mm_set1_epi8('a' - '0' - 10);
+    const __m128i low_byte     = _mm_set1_epi16(0x00FF);
+    __m128i       c, l, digit, alpha;
+
+    for (; (i + 8U) <= n; i += 8U)
     {
-    case CAT_FSM_TYPE_ATCMD:
-        self->position = 0;
-        break;
-    case CAT_FSM_TYPE_UNSOLICITED:
-        self->unsolicited_fsm.position = 0;
-        break;
-    default:
-        assert(false);
+        c     = _mm_loadu_si128((const __m128i*) &src[2U * i]);
+        l     = _mm_or_si128(c, case_bit);
+        digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+        alpha = _mm_and_si128(_mm_cmpgt_epi8(l, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(l, _mm_set1_epi8('f' + 1)));
+        if (_mm_movemask_epi8(_mm_or_si128(digit, alpha)) != 0xFFFF)
+            break;
+
+        /* digits have case bit already set, so both digits and letters are converted from lower case */
+        l = _mm_sub_epi8(_mm_sub_epi8(l, _mm_set1_epi8('0')), _mm_and_si128(alpha, alpha_offset));
+        l = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(l, low_byte), 4), _mm_srli_epi16(l, 8));
+        _mm_storel_epi64((__m128i*) &dst[i], _mm_packus_epi16(l, l));
+    }
+#elif defined(CAT_SIMD_NEON)
+    uint8x16_t c, digit, alpha, is_digit;
+    uint16x8_t w;
+
+    for (; (i + 8U) <= n; i += 8U)
+    {
+        c        = vld1q_u8((const uint8_t*) &src[2U * i]);
+        digit    = vsubq_u8(c, vdupq_n_u8('0'));
+        alpha    = vsubq_u8(vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+        is_digit = vcleq_u8(digit, vdupq_n_u8(9));
+        if (vminvq_u8(vorrq_u8(is_digit, vcleq_u8(alpha, vdupq_n_u8(5)))) == 0)
+            break;
+
+        /* pairs of digit values are joined in 16-bit lanes (first char in low byte) */
+        w = vreinterpretq_u16_u8(vbslq_u8(is_digit, digit, vaddq_u8(alpha, vdupq_n_u8(10))));
+        vst1_u8(&dst[i], vmovn_u16(vorrq_u16(vshlq_n_u16(w, 4), vshrq_n_u16(w, 8))));
+    }
+#endif
+
+    for (; i < n; i++)
+    {
+        hi = hex_values[(uint8_t) src[2U * i]];
+        lo = hex_values[(uint8_t) src[2U * i + 1U]];
+        if ((hi == 0) || (lo == 0))
+            break;
+        dst[i] = (uint8_t) (((hi - 1U) << 4) | (lo - 1U));
     }
+    return i;
 }
 
-static struct cat_variable* get_var_by_fsm(struct cat_object* self, cat_fsm_type fsm)
+static const char base64_digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* value of base64 char plus one (0 - not base64 char) */
+static const uint8_t base64_values[256] = {
+    ['A'] = 1,  ['B'] = 2,  ['C'] = 3,  ['D'] = 4,  ['E'] = 5,  ['F'] = 6,  ['G'] = 7,  ['H'] = 8,
+    ['I'] = 9,  ['J'] = 10, ['K'] = 11, ['L'] = 12, ['M'] = 13, ['N'] = 14, ['O'] = 15, ['P'] = 16,
+    ['Q'] = 17, ['R'] = 18, ['S'] = 19, ['T'] = 20, ['U'] = 21, ['V'] = 22, ['W'] = 23, ['X'] = 24,
+    ['Y'] = 25, ['Z'] = 26, ['a'] = 27, ['b'] = 28, ['c'] = 29, ['d'] = 30, ['e'] = 31, ['f'] = 32,
+    ['g'] = 33, ['h'] = 34, ['i'] = 35, ['j'] = 36, ['k'] = 37, ['l'] = 38, ['m'] = 39, ['n'] = 40,
+    ['o'] = 41, ['p'] = 42, ['q'] = 43, ['r'] = 44, ['s'] = 45, ['t'] = 46, ['u'] = 47, ['v'] = 48,
+    ['w'] = 49, ['x'] = 50, ['y'] = 51, ['z'] = 52, ['0'] = 53, ['1'] = 54, ['2'] = 55, ['3'] = 56,
+    ['4'] = 57, ['5'] = 58, ['6'] = 59, ['7'] = 60, ['8'] = 61, ['9'] = 62, ['+'] = 63, ['/'] = 64,
+};
+
+/* encodes n bytes into 4 * ((n + 2) / 3) base64 chars with padding */
+static void encode_base64(char* dst, const uint8_t* src, size_t n)
 {
-    assert(self != NULL);
-    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+    uint32_t v;
 
-    switch (fsm)
+#ifdef CAT_SIMD_NEON
+    uint8x16x4_t digits, out;
+    uint8x16x3_t in;
+
+    digits.val[0] = vld1q_u8((const uint8_t*) &base64_digits[0]);
+    digits.val[1] = vld1q_u8((const uint8_t*) &base64_digits[16]);
+    digits.val[2] = vld1q_u8((const uint8_t*) &base64_digits[32]);
+    digits.val[3] = vld1q_u8((const uint8_t*) &base64_digits[48]);
+
+    /* 48 bytes are deinterleaved into 3 lanes and encoded to 64 chars */
+    for (; n >= 48U; n -= 48U)
+    {
+        in         = vld3q_u8(src);
+        out.val[0] = vshrq_n_u8(in.val[0], 2);
+        out.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(in.val[0], vdupq_n_u8(0x03)), 4), vshrq_n_u8(in.val[1], 4));
+        out.val[2] = vorrq_u8(vshlq_n_u8(vandq_u8(in.val[1], vdupq_n_u8(0x0F)), 2), vshrq_n_u8(in.val[2], 6));
+        out.val[3] = vandq_u8(in.val[2], vdupq_n_u8(0x3F));
+
+        out.val[0] = vqtbl4q_u8(digits, out.val[0]);
+        out.val[1] = vqtbl4q_u8(digits, out.val[1]);
+        out.val[2] = vqtbl4q_u8(digits, out.val[2]);
+        out.val[3] = vqtbl4q_u8(digits, out.val[3]);
+        vst4q_u8((uint8_t*) dst, out);
+        src += 48;
+        dst += 64;
+    }
+#endif
+
+    for (; n >= 3U; n -= 3U)
+    {
+        v      = ((uint32_t) src[0] << 16) | ((uint32_t) src[1] << 8) | src[2];
+        dst[0] = base64_digits[v >> 18];
+        dst[1] = base64_digits[(v >> 12) & 0x3FU];
+        dst[2] = base64_digits[(v >> 6) & 0x3FU];
+        dst[3] = base64_digits[v & 0x3FU];
+        src += 3;
+        dst += 4;
+    }
+
+    if (n == 0)
+        return;
+
+    v      = ((uint32_t) src[0] << 16) | ((n > 1U) ? ((uint32_t) src[1] << 8) : 0U);
+    dst[0] = base64_digits[v >> 18];
+    dst[1] = base64_digits[(v >> 12) & 0x3FU];
+    dst[2] = (n > 1U) ? base64_digits[(v >> 6) & 0x3FU] : '=';
+    dst[3] = '=';
+}
+
+/* decodes up to n not padded quads of base64 chars into 3 * n bytes, stops at first quad with not base64 char */
+static size_t decode_base64(uint8_t* dst, const char* src, size_t n)
+{
+    size_t   i = 0;
+    uint32_t v;
+    uint8_t  a, b, c, d;
+
+#ifdef CAT_SIMD_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    __m128i       in, upper, lower, digit, plus, slash, offset;
+    uint32_t      quads[4];
+    size_t        j;
+
+    for (; (i + 4U) <= n; i += 4U)
+    {
+        /* chars above 0x7F are negative in signed compares, so they fall out of all ranges */
+        in    = _mm_loadu_si128((const __m128i*) &src[4U * i]);
+        upper = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('Z' + 1)));
+        lower = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('z' + 1)));
+        digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('9' + 1)));
+        plus  = _mm_cmpeq_epi8(in, _mm_set1_epi8('+'));
+        slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), digit), _mm_or_si128(plus, slash))) != 0xFFFF)
+            break;
+
+        offset = _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')), _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+        offset = _mm_or_si128(offset, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+        offset = _mm_or_si128(offset, _mm_or_si128(_mm_and_si128(plus, _mm_set1_epi8(62 - '+')), _mm_and_si128(slash, _mm_set1_epi8(63 - '/'))));
+        in     = _mm_add_epi8(in, offset);
+
+        /* 6-bit values are merged into 12-bit pairs and then into 24-bit quads */
+        in = _mm_packs_epi32(_mm_madd_epi16(_mm_unpacklo_epi8(in, zero), _mm_set1_epi32(0x00010040)),
+                             _mm_madd_epi16(_mm_unpackhi_epi8(in, zero), _mm_set1_epi32(0x00010040)));
+        _mm_storeu_si128((__m128i*) quads, _mm_madd_epi16(in, _mm_set1_epi32(0x00011000)));
+
+        for (j = 0; j < 4U; j++)
+        {
+            dst[3U * (i + j)]      = (uint8_t) (quads[j] >> 16);
+            dst[3U * (i + j) + 1U] = (uint8_t) (quads[j] >> 8);
+            dst[3U * (i + j) + 2U] = (uint8_t) quads[j];
+        }
+    }
+#elif defined(CAT_SIMD_NEON)
+    uint8x16x4_t values_lo, values_hi, in;
+    uint8x16x3_t out;
+    size_t       k;
+
+    /* values table (value plus one, 0 - not base64 char) split for chars 0x00 - 0x3F and 0x40 - 0x7F */
+    for (k = 0; k < 4U; k++)
+    {
+        values_lo.val[k] = vld1q_u8(&base64_values[16U * k]);
+        values_hi.val[k] = vld1q_u8(&base64_values[64U + 16U * k]);
+    }
+
+    for (; (i + 16U) <= n; i += 16U)
+    {
+        in = vld4q_u8((const uint8_t*) &src[4U * i]);
+        for (k = 0; k < 4U; k++)
+        {
+            /* out of range indexes give 0, so chars above 0x7F are not valid */
+            in.val[k] = vorrq_u8(vqtbl4q_u8(values_lo, in.val[k]), vqtbl4q_u8(values_hi, vsubq_u8(in.val[k], vdupq_n_u8(0x40))));
+        }
+        if (vminvq_u8(vminq_u8(vminq_u8(in.val[0], in.val[1]), vminq_u8(in.val[2], in.val[3]))) == 0)
+            break;
+
+        for (k = 0; k < 4U; k++)
+            in.val[k] = vsubq_u8(in.val[k], vdupq_n_u8(1));
+
+        out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
+        vst3q_u8(&dst[3U * i], out);
+    }
+#endif
+
+    for (; i < n; i++)
+    {
+        a = base64_values[(uint8_t) src[4U * i]];
+        b = base64_values[(uint8_t) src[4U * i + 1U]];
+        c = base64_values[(uint8_t) src[4U * i + 2U]];
+        d = base64_values[(uint8_t) src[4U * i + 3U]];
+        if ((a == 0) || (b == 0) || (c == 0) || (d == 0))
+            break;
+
+        v                = ((uint32_t) (a - 1U) << 18) | ((uint32_t) (b - 1U) << 12) | ((uint32_t) (c - 1U) << 6) | (uint32_t) (d - 1U);
+        dst[3U * i]      = (uint8_t) (v >> 16);
+        dst[3U * i + 1U] = (uint8_t) (v >> 8);
+        dst[3U * i + 2U] = (uint8_t) v;
+    }
+    return i;
+}
+
+/* escaped char for chars which need escaping in string variables (0 - copied as is) */
+static const char string_escapes[256] = {
+    ['\\'] = '\\',
+    ['"']  = '"',
+    ['\n'] = 'n',
+};
+
+/* returns length of leading run of chars which do not need escaping */
+static size_t find_string_escape(const char* src, size_t n)
+{
+    size_t i = 0;
+
+#ifdef CAT_SIMD_SSE2
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i quote     = _mm_set1_epi8('"');
+    const __m128i new_line  = _mm_set1_epi8('\n');
+    __m128i       in;
+    __m128i       hit;
+
+    for (; i + 16U <= n; i += 16U)
+    {
+        in  = _mm_loadu_si128((const __m128i*) &src[i]);
+        hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(in, backslash), _mm_cmpeq_epi8(in, quote)), _mm_cmpeq_epi8(in, new_line));
+        if (_mm_movemask_epi8(hit) != 0)
+            break;
+    }
+#endif
+
+    while ((i < n) && (string_escapes[(uint8_t) src[i]] == 0))
+        i++;
+    return i;
+}
+
+/* maximum number of chars produced by integer conversion ("-9223372036854775808" or "0x" with 16 digits) */
+#define CAT_NUM_STR_MAX (20U)
+
+static const char dec_digit_pairs[] = "00010203040506070809"
+                                      "10111213141516171819"
+                                      "20212223242526272829"
+                                      "30313233343536373839"
+                                      "40414243444546474849"
+                                      "50515253545556575859"
+                                      "60616263646566676869"
+                                      "70717273747576777879"
+                                      "80818283848586878889"
+                                      "90919293949596979899";
+
+/* writes decimal digits backward ending just before end pointer, returns number of written chars */
+static size_t convert_uint_to_dec(char* end, uint64_t val)
+{
+    char*    p = end;
+    uint32_t v;
+    uint32_t i;
+
+    /* 64-bit division is expensive on small cores, so use it only until value fits into 32 bits */
+    while (val > UINT32_MAX)
+    {
+        i   = (uint32_t) (val % 100U) * 2U;
+        val /= 100U;
+        *--p = dec_digit_pairs[i + 1U];
+        *--p = dec_digit_pairs[i];
+    }
+
+    v = (uint32_t) val;
+    while (v >= 100U)
+    {
+        i = (v % 100U) * 2U;
+        v /= 100U;
+        *--p = dec_digit_pairs[i + 1U];
+        *--p = dec_digit_pairs[i];
+    }
+
+    if (v >= 10U)
+    {
+        i    = v * 2U;
+        *--p = dec_digit_pairs[i + 1U];
+        *--p = dec_digit_pairs[i];
+    }
+    else
+    {
+        *--p = (char) ('0' + v);
+    }
+
+    return (size_t) (end - p);
+}
+
+/* same as above, with leading minus sign for negative values */
+static size_t convert_int_to_dec(char* end, int64_t val)
+{
+    size_t n;
+
+    if (val >= 0)
+        return convert_uint_to_dec(end, (uint64_t) val);
+
+    n                       = convert_uint_to_dec(end, (uint64_t) 0 - (uint64_t) val);
+    end[-1 - (ptrdiff_t) n] = '-';
+    return n + 1U;
+}
+
+/* writes "0x" prefixed hexadecimal value zero padded to width bytes, returns number of written chars */
+static size_t convert_uint_to_hex(char* dst, uint64_t val, size_t width)
+{
+    size_t n = width * 2U;
+
+    dst[0] = '0';
+    dst[1] = 'x';
+    while (n > 0)
+    {
+        dst[1U + n--] = hex_digits[val & 0x0FU];
+        val >>= 4;
+    }
+    return width * 2U + 2U;
+}
+
+static int append_nstring(uint8_t* data, size_t* data_size, const size_t max_data_size, const char* str, size_t len)
+{
+    if ((*data_size >= max_data_size) || (len >= max_data_size - *data_size))
+        return -1;
+
+    memcpy(&data[*data_size], str, len);
+    *data_size += len;
+    data[*data_size] = '\0';
+    return 0;
+}
+
+int cat_append_int(uint8_t* data, size_t* data_size, const size_t max_data_size, int64_t val)
+{
+    char   tmp[CAT_NUM_STR_MAX];
+    size_t n;
+
+    assert(data != NULL);
+    assert(data_size != NULL);
+
+    n = convert_int_to_dec(&tmp[sizeof(tmp)], val);
+    return append_nstring(data, data_size, max_data_size, &tmp[sizeof(tmp) - n], n);
+}
+
+int cat_append_uint(uint8_t* data, size_t* data_size, const size_t max_data_size, uint64_t val)
+{
+    char   tmp[CAT_NUM_STR_MAX];
+    size_t n;
+
+    assert(data != NULL);
+    assert(data_size != NULL);
+
+    n = convert_uint_to_dec(&tmp[sizeof(tmp)], val);
+    return append_nstring(data, data_size, max_data_size, &tmp[sizeof(tmp) - n], n);
+}
+
+int cat_append_hex(uint8_t* data, size_t* data_size, const size_t max_data_size, uint64_t val, size_t width)
+{
+    char tmp[CAT_NUM_STR_MAX];
+
+    assert(data != NULL);
+    assert(data_size != NULL);
+
+    if ((width == 0) || (width > sizeof(uint64_t)))
+        return -1;
+
+    return append_nstring(data, data_size, max_data_size, tmp, convert_uint_to_hex(tmp, val, width));
+}
+
+static void end_processing_with_error(struct cat_object* self, cat_fsm_type fsm)
+{
+    assert(self != NULL);
+    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+
+    switch (fsm)
+    {
+    case CAT_FSM_TYPE_ATCMD:
+        ack_error(self);
+        break;
+    case CAT_FSM_TYPE_UNSOLICITED:
+        unsolicited_reset_state(self);
+        break;
+    default:
+        assert(false);
+    }
+}
+
+static void end_processing_with_ok(struct cat_object* self, cat_fsm_type fsm)
+{
+    assert(self != NULL);
+    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+
+    switch (fsm)
+    {
+    case CAT_FSM_TYPE_ATCMD:
+        ack_ok(self);
+        break;
+    case CAT_FSM_TYPE_UNSOLICITED:
+        unsolicited_reset_state(self);
+        break;
+    default:
+        assert(false);
+    }
+}
+
+static void reset_position(struct cat_object* self, cat_fsm_type fsm)
+{
+    assert(self != NULL);
+    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+
+    switch (fsm)
+    {
+    case CAT_FSM_TYPE_ATCMD:
+        self->position = 0;
+        break;
+    case CAT_FSM_TYPE_UNSOLICITED:
+        self->unsolicited_fsm.position = 0;
+        break;
+    default:
+        assert(false);
+    }
+}
+
+static struct cat_variable* get_var_by_fsm(struct cat_object* self, cat_fsm_type fsm)
+{
+    assert(self != NULL);
+    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+
+    switch (fsm)
     {
     case CAT_FSM_TYPE_ATCMD:
         return (struct cat_variable*) self->var;
@@ -800,6 +1669,14 @@ static bool is_command_disable(struct cat_object* self, size_t index)
     assert(self != NULL);
     assert(index < self->commands_num);
 
+    if (self->cmd_index != NULL)
+    {
+        if (self->desc->cmd_group[self->cmd_index[index].group]->disable != false)
+            return true;
+
+        return (self->cmd_index[index].cmd->disable != false) ? true : false;
+    }
+
     j = 0;
     for (i = 0; i < self->desc->cmd_group_num; i++)
     {
@@ -855,10 +1732,67 @@ static void set_cmd_state(struct cat_object* self, size_t i, uint8_t state)
     get_atcmd_buf(self)[n] = s;
 }
 
+static struct cat_command const* trie_get_exact_command(struct cat_object* self)
+{
+    size_t                      i;
+    struct cat_command const*   cmd;
+    struct cat_trie_node const* node = &self->trie[self->trie_node];
+
+    /* exact matches are sorted before longer names with the same prefix */
+    for (i = node->begin; i < node->end; i++)
+    {
+        cmd = get_command_by_index(self, self->trie_order[i]);
+        if (cmd->name[self->length] != '\0')
+            break;
+        if (is_command_disable(self, self->trie_order[i]) == false)
+            return cmd;
+    }
+
+    return NULL;
+}
+
+static cat_status trie_update_command(struct cat_object* self)
+{
+    size_t                      child;
+    struct cat_command const*   cmd;
+    struct cat_trie_node const* trie = self->trie;
+
+    self->state = CAT_STATE_PARSE_COMMAND_CHAR;
+
+    /* root node is never a child, so 0 after first char means no match */
+    if ((self->length > 1) && (self->trie_node == 0))
+        return CAT_STATUS_BUSY;
+
+    child = trie[self->trie_node].child;
+    while ((child != 0) && (trie[child].ch < self->current_char))
+        child = trie[child].sibling;
+
+    if ((child == 0) || (trie[child].ch != self->current_char))
+    {
+        self->trie_node = 0;
+        return CAT_STATUS_BUSY;
+    }
+
+    self->trie_node = child;
+
+    cmd = trie_get_exact_command(self);
+    if ((cmd != NULL) && (cmd->implicit_write != false))
+    {
+        self->cmd_type = CAT_CMD_TYPE_WRITE;
+        prepare_search_command(self);
+        self->state = CAT_STATE_SEARCH_COMMAND;
+    }
+
+    return CAT_STATUS_BUSY;
+}
+
 static cat_status update_command(struct cat_object* self)
 {
     assert(self != NULL);
 
+    if (self->trie != NULL)
+        return trie_update_command(self);
+
     struct cat_command const* cmd = get_command_by_index(self, self->index);
     size_t                    cmd_name_len;
 
@@ -947,6 +1881,13 @@ static void start_processing_format_test_args(struct cat_object* self, cat_fsm_t
         return;
     }
 
+    if (cmd->test_args != NULL)
+    {
+        if ((print_string_to_buf(self, cmd->test_args, fsm) != 0) || (print_response_test(self, fsm) != 0))
+            end_processing_with_error(self, fsm);
+        return;
+    }
+
     if ((cmd->var != NULL) && (cmd->var_num > 0))
     {
         switch (fsm)
@@ -995,10 +1936,57 @@ static cat_status wait_test_acknowledge(struct cat_object* self)
     return CAT_STATUS_BUSY;
 }
 
+static cat_status trie_search_command(struct cat_object* self)
+{
+    size_t                      i;
+    struct cat_command const*   cmd;
+    struct cat_trie_node const* node;
+
+    if (self->trie_node == 0)
+    {
+        self->state = (self->current_char == '\n') ? CAT_STATE_COMMAND_NOT_FOUND : CAT_STATE_ERROR;
+        return CAT_STATUS_BUSY;
+    }
+
+    self->cmd = trie_get_exact_command(self);
+    if (self->cmd != NULL)
+    {
+        self->state = CAT_STATE_COMMAND_FOUND;
+        return CAT_STATUS_BUSY;
+    }
+
+    node = &self->trie[self->trie_node];
+    for (i = node->begin; i < node->end; i++)
+    {
+        if (is_command_disable(self, self->trie_order[i]) != false)
+            continue;
+
+        cmd = get_command_by_index(self, self->trie_order[i]);
+        if (self->cmd != NULL)
+        {
+            self->state = CAT_STATE_COMMAND_NOT_FOUND;
+            return CAT_STATUS_BUSY;
+        }
+        self->cmd = cmd;
+    }
+
+    if (self->cmd == NULL)
+    {
+        self->state = (self->current_char == '\n') ? CAT_STATE_COMMAND_NOT_FOUND : CAT_STATE_ERROR;
+        return CAT_STATUS_BUSY;
+    }
+
+    self->state = CAT_STATE_COMMAND_FOUND;
+    return CAT_STATUS_BUSY;
+}
+
 static cat_status search_command(struct cat_object* self)
 {
     assert(self != NULL);
 
+    if (self->trie != NULL)
+        return trie_search_command(self);
+
     uint8_t cmd_state = get_cmd_state(self, self->index);
 
     if (cmd_state != CAT_CMD_STATE_NOT_MATCH)
@@ -1127,6 +2115,8 @@ static cat_status command_found(struct cat_object* self)
     case CAT_CMD_TYPE_WRITE:
         self->length           = 0;
         get_atcmd_buf(self)[0] = 0;
+        self->var              = NULL;
+        self->stream_args_flag = (self->cmd->stream_args != false) && (is_write_args_possible(self, self->cmd) != false);
         self->state            = CAT_STATE_PARSE_COMMAND_ARGS;
         break;
     default:
@@ -1145,15 +2135,27 @@ static cat_status command_not_found(struct cat_object* self)
     return CAT_STATUS_BUSY;
 }
 
+/* appends decimal digit to value, fails when value would not fit into 64 bits */
+static int accumulate_dec_digit(uint64_t* val, char ch)
+{
+    const uint64_t digit = (uint64_t) (ch - '0');
+
+    if (*val > (UINT64_MAX - digit) / 10U)
+        return -1;
+
+    *val = *val * 10U + digit;
+    return 0;
+}
+
 static int parse_int_decimal(struct cat_object* self, int64_t* ret)
 {
     assert(self != NULL);
     assert(ret != NULL);
 
-    char    ch;
-    int64_t val  = 0;
-    int64_t sign = 0;
-    int     ok   = 0;
+    char     ch;
+    uint64_t val  = 0;
+    int64_t  sign = 0;
+    int      ok   = 0;
 
     while (1)
     {
@@ -1162,8 +2164,9 @@ static int parse_int_decimal(struct cat_object* self, int64_t* ret)
             continue; //!< skip space
         if ((ok != 0) && ((ch == 0) || (ch == ',')))
         {
-            val *= sign;
-            *ret = val;
+            if (val > ((sign < 0) ? ((uint64_t) INT64_MAX + 1U) : (uint64_t) INT64_MAX))
+                return -1;
+            *ret = (sign < 0) ? (-(int64_t) (val - 1U) - 1) : (int64_t) val;
             return (ch == ',') ? 1 : 0;
         }
 
@@ -1190,11 +2193,9 @@ static int parse_int_decimal(struct cat_object* self, int64_t* ret)
         }
         else
         {
-            if (is_valid_dec_char(ch) != 0)
+            if ((is_valid_dec_char(ch) != 0) && (accumulate_dec_digit(&val, ch) == 0))
             {
                 ok = 1;
-                val *= 10;
-                val += ch - '0';
             }
             else
             {
@@ -1226,11 +2227,9 @@ static int parse_uint_decimal(struct cat_object* self, uint64_t* ret)
             return (ch == ',') ? 1 : 0;
         }
 
-        if (is_valid_dec_char(ch) != 0)
+        if ((is_valid_dec_char(ch) != 0) && (accumulate_dec_digit(&val, ch) == 0))
         {
             ok = 1;
-            val *= 10;
-            val += ch - '0';
         }
         else
         {
@@ -1277,7 +2276,7 @@ static int parse_num_hexadecimal(struct cat_object* self, uint64_t* ret)
         }
         else if (state >= 2)
         {
-            if (is_valid_hex_char(ch) != 0)
+            if ((is_valid_hex_char(ch) != 0) && ((val >> 60) == 0))
             {
                 state = 3;
                 val <<= 4;
@@ -1293,404 +2292,1029 @@ static int parse_num_hexadecimal(struct cat_object* self, uint64_t* ret)
     return -1;
 }
 
-static int parse_buffer_hexadecimal(struct cat_object* self)
+static void start_parse_var(struct cat_object* self)
 {
     assert(self != NULL);
 
-    char    ch;
-    uint8_t byte  = 0;
-    int     state = 0;
-    size_t  size  = 0;
+    self->arg_size   = 0;
+    self->arg_offset = 0;
+    self->arg_state  = 0;
+    self->arg_byte   = 0;
+}
 
-    while (1)
+static int put_var_byte(struct cat_object* self, uint8_t byte)
+{
+    assert(self != NULL);
+
+    if (self->arg_size >= self->var->data_size)
     {
-        ch = get_atcmd_buf(self)[self->position++];
-        if (ch == ' ')
-            continue; //!< skip space
-        ch = to_upper(ch);
+        if (self->var->chunk == NULL)
+            return -1;
+        if ((self->var->access != CAT_VAR_ACCESS_READ_ONLY) && (self->var->chunk(self->var, self->arg_offset, self->arg_size) != 0))
+            return -1;
+        self->arg_offset += self->arg_size;
+        self->arg_size = 0;
+    }
 
-        if ((size > 0) && (state == 0) && ((ch == 0) || (ch == ',')))
-        {
-            if (self->var->access == CAT_VAR_ACCESS_READ_ONLY)
-            {
-                self->write_size = 0;
-            }
-            else
-            {
-                self->write_size = size;
-            }
-            return (ch == ',') ? 1 : 0;
-        }
-
-        if (is_valid_hex_char(ch) == 0)
-            return -1;
+    if (self->var->access != CAT_VAR_ACCESS_READ_ONLY)
+        ((uint8_t*) (self->var->data))[self->arg_size] = byte;
+    self->arg_size++;
+    return 0;
+}
 
-        byte <<= 4;
-        byte += convert_hex_char_to_value(ch);
+static int finish_buffer_var(struct cat_object* self, bool terminate)
+{
+    assert(self != NULL);
 
-        if (state != 0)
-        {
-            if (size >= self->var->data_size)
-                return -1;
-            if (self->var->access == CAT_VAR_ACCESS_READ_ONLY)
-            {
-                size++;
-            }
-            else
-            {
-                ((uint8_t*) (self->var->data))[size++] = byte;
-            }
-            byte = 0;
-        }
+    if ((terminate != false) && (self->var->chunk == NULL) && (self->arg_size >= self->var->data_size))
+        return -1;
 
-        state = !state;
+    if (self->var->access == CAT_VAR_ACCESS_READ_ONLY)
+    {
+        self->write_size = 0;
+        return 0;
     }
 
-    return -1;
+    if ((self->var->chunk != NULL) && (self->arg_size > 0) && (self->var->chunk(self->var, self->arg_offset, self->arg_size) != 0))
+        return -1;
+
+    if ((terminate != false) && (self->arg_size < self->var->data_size))
+        ((uint8_t*) (self->var->data))[self->arg_size] = 0;
+
+    self->write_size = self->arg_offset + self->arg_size;
+    return 0;
 }
 
-static int parse_buffer_string(struct cat_object* self)
+static int parse_buffer_hexadecimal_char(struct cat_object* self, char ch)
 {
     assert(self != NULL);
 
-    char   ch;
-    int    state = 0;
-    size_t size  = 0;
+    uint8_t val;
 
-    while (1)
+    if (ch == ' ')
+        return CAT_PARSE_ARG_MORE; //!< skip space
+
+    if (((self->arg_offset + self->arg_size) > 0) && (self->arg_state == 0) && ((ch == 0) || (ch == ',')))
     {
-        ch = get_atcmd_buf(self)[self->position++];
+        if (finish_buffer_var(self, false) != 0)
+            return -1;
+        return (ch == ',') ? 1 : 0;
+    }
 
-        switch (state)
-        {
-        case 0:
-            if (ch == ' ')
-            {
-                continue; //!< skip space
-            }
-            else //!< other characters enter state 1
-            {
-                if (ch != '"')
-                {
-                    ((uint8_t*) (self->var->data))[size++] = ch; //!< Save the first character if not quote
-                }
-                state = 1;
-            }
-            break;
-        case 1:
-            if (ch == 0 || ch == ',') //!< end of string, cat will add null character automatically
-            {
-                if (size)
-                {
-                    self->position--; //!< put back the null character for next processing
-                    state = 3;
-                    break;
-                }
-                return -1;
-            }
-            if (ch == '\\')
-            {
-                state = 2;
-                break;
-            }
-            if (ch == '"')
-            {
-                state = 3;
-                break;
-            }
-            if (size >= self->var->data_size)
-                return -1;
-            if (self->var->access == CAT_VAR_ACCESS_READ_ONLY)
-            {
-                size++;
-            }
-            else
-            {
-                ((uint8_t*) (self->var->data))[size++] = ch;
-            }
-            break;
-        case 2:
-            switch (ch)
-            {
-            case '\\':
-                ch = '\\';
-                break;
-            case '"':
-                ch = '"';
-                break;
-            case 'n':
-                ch = '\n';
-                break;
-            default:
-                return -1;
-            }
-            if (size >= self->var->data_size)
-                return -1;
-            if (self->var->access == CAT_VAR_ACCESS_READ_ONLY)
-            {
-                size++;
-            }
-            else
-            {
-                ((uint8_t*) (self->var->data))[size++] = ch;
-            }
-            state = 1;
-            break;
-        case 3:
-            if ((ch == 0) || (ch == ','))
-            {
-                if (size >= self->var->data_size)
-                    return -1;
-                if (self->var->access == CAT_VAR_ACCESS_READ_ONLY)
-                {
-                    self->write_size = 0;
-                }
-                else
-                {
-                    ((uint8_t*) (self->var->data))[size] = 0;
-                    self->write_size                     = size;
-                }
-                return (ch == ',') ? 1 : 0;
-            }
-            else
-            {
-                return -1;
-            }
-            break;
-        default:
-            break;
-        }
+    val = hex_values[(uint8_t) ch];
+    if (val == 0)
+        return -1;
+
+    self->arg_byte <<= 4;
+    self->arg_byte += val - 1U;
+
+    if (self->arg_state != 0)
+    {
+        if (put_var_byte(self, self->arg_byte) != 0)
+            return -1;
+        self->arg_byte = 0;
     }
 
-    return -1;
+    self->arg_state = !self->arg_state;
+    return CAT_PARSE_ARG_MORE;
 }
 
-static int validate_int_range(struct cat_object* self, int64_t val)
+static int parse_buffer_string_char(struct cat_object* self, char ch)
 {
-    if (self->var->access == CAT_VAR_ACCESS_READ_ONLY)
-    {
-        self->write_size = 0;
-        return 0;
-    }
+    assert(self != NULL);
 
-    switch (self->var->data_size)
+    switch (self->arg_state)
     {
+    case 0:
+        if (ch == ' ')
+            return CAT_PARSE_ARG_MORE; //!< skip space
+
+        self->arg_state = 1;
+        if (ch != '"')
+            return parse_buffer_string_char(self, ch); //!< first character of not quoted string
+        break;
     case 1:
-        if ((val < INT8_MIN) || (val > INT8_MAX))
+        if ((ch == 0) || (ch == ',')) //!< end of not quoted string, cat will add null character automatically
+        {
+            if ((self->arg_offset + self->arg_size) == 0)
+                return -1;
+            if (finish_buffer_var(self, true) != 0)
+                return -1;
+            return (ch == ',') ? 1 : 0;
+        }
+        if (ch == '\\')
+        {
+            self->arg_state = 2;
+            break;
+        }
+        if (ch == '"')
+        {
+            self->arg_state = 3;
+            break;
+        }
+        if (put_var_byte(self, ch) != 0)
             return -1;
-        *(int8_t*) (self->var->data) = val;
         break;
     case 2:
-        if ((val < INT16_MIN) || (val > INT16_MAX))
+        switch (ch)
+        {
+        case '\\':
+            ch = '\\';
+            break;
+        case '"':
+            ch = '"';
+            break;
+        case 'n':
+            ch = '\n';
+            break;
+        default:
             return -1;
-        *(int16_t*) (self->var->data) = val;
-        break;
-    case 4:
-        if ((val < INT32_MIN) || (val > INT32_MAX))
+        }
+        if (put_var_byte(self, ch) != 0)
             return -1;
-        *(int32_t*) (self->var->data) = val;
+        self->arg_state = 1;
         break;
+    case 3:
+        if ((ch != 0) && (ch != ','))
+            return -1;
+        if (finish_buffer_var(self, true) != 0)
+            return -1;
+        return (ch == ',') ? 1 : 0;
     default:
         return -1;
     }
-    self->write_size = self->var->data_size;
-    return 0;
+
+    return CAT_PARSE_ARG_MORE;
 }
 
-static int validate_uint_range(struct cat_object* self, uint64_t val)
+static int parse_buffer_base64_char(struct cat_object* self, char ch)
 {
-    if (self->var->access == CAT_VAR_ACCESS_READ_ONLY)
+    assert(self != NULL);
+
+    uint8_t val;
+    uint8_t byte;
+
+    if (ch == ' ')
+        return CAT_PARSE_ARG_MORE; //!< skip space
+
+    /* states 0 - 3 are positions in quad, 4 - waiting for second padding char, 5 - padded quad */
+    if ((ch == 0) || (ch == ','))
     {
-        self->write_size = 0;
-        return 0;
+        if (((self->arg_offset + self->arg_size) == 0) || ((self->arg_state != 0) && (self->arg_state != 5)))
+            return -1;
+        if (finish_buffer_var(self, false) != 0)
+            return -1;
+        return (ch == ',') ? 1 : 0;
     }
 
-    switch (self->var->data_size)
+    if (ch == '=')
+    {
+        /* unused low bits of last char before padding have to be zero (only canonical encoding is accepted) */
+        if (((self->arg_state == 2) || (self->arg_state == 3)) && (self->arg_byte != 0))
+            return -1;
+
+        if (self->arg_state == 2)
+            self->arg_state = 4;
+        else if ((self->arg_state == 3) || (self->arg_state == 4))
+            self->arg_state = 5;
+        else
+            return -1;
+        return CAT_PARSE_ARG_MORE;
+    }
+
+    val = base64_values[(uint8_t) ch];
+    if ((val == 0) || (self->arg_state > 3))
+        return -1;
+    val--;
+
+    switch (self->arg_state)
     {
+    case 0:
+        self->arg_byte = (uint8_t) (val << 2);
+        break;
     case 1:
-        if (val > UINT8_MAX)
+        byte           = self->arg_byte | (val >> 4);
+        self->arg_byte = (uint8_t) (val << 4);
+        if (put_var_byte(self, byte) != 0)
             return -1;
-        *(uint8_t*) (self->var->data) = val;
         break;
     case 2:
-        if (val > UINT16_MAX)
+        byte           = self->arg_byte | (val >> 2);
+        self->arg_byte = (uint8_t) (val << 6);
+        if (put_var_byte(self, byte) != 0)
             return -1;
-        *(uint16_t*) (self->var->data) = val;
         break;
-    case 4:
-        if (val > UINT32_MAX)
+    default:
+        if (put_var_byte(self, self->arg_byte | val) != 0)
             return -1;
-        *(uint32_t*) (self->var->data) = val;
         break;
-    default:
-        return -1;
     }
-    self->write_size = self->var->data_size;
-    return 0;
+
+    self->arg_state = (self->arg_state + 1U) & 0x03U;
+    return CAT_PARSE_ARG_MORE;
 }
 
-static cat_status parse_write_args(struct cat_object* self)
+static bool is_buffer_var(struct cat_variable const* var)
 {
-    int64_t    val;
-    cat_status stat;
+    return (var->type == CAT_VAR_BUF_HEX) || (var->type == CAT_VAR_BUF_STRING) || (var->type == CAT_VAR_BUF_BASE64);
+}
 
+static int parse_buffer_char(struct cat_object* self, char ch)
+{
     assert(self != NULL);
 
     switch (self->var->type)
     {
-    case CAT_VAR_INT_DEC:
-        stat = parse_int_decimal(self, &val);
-        if (stat < 0)
-        {
-            ack_error(self);
-            return CAT_STATUS_BUSY;
-        }
-        if (validate_int_range(self, val) != 0)
-        {
-            ack_error(self);
-            return CAT_STATUS_BUSY;
-        }
-        break;
-    case CAT_VAR_UINT_DEC:
-        stat = parse_uint_decimal(self, (uint64_t*) &val);
-        if (stat < 0)
-        {
-            ack_error(self);
-            return CAT_STATUS_BUSY;
-        }
-        if (validate_uint_range(self, val) != 0)
-        {
-            ack_error(self);
-            return CAT_STATUS_BUSY;
-        }
-        break;
-    case CAT_VAR_NUM_HEX:
-        stat = parse_num_hexadecimal(self, (uint64_t*) &val);
-        if (stat < 0)
-        {
-            ack_error(self);
-            return CAT_STATUS_BUSY;
-        }
-        if (validate_uint_range(self, val) != 0)
-        {
-            ack_error(self);
-            return CAT_STATUS_BUSY;
-        }
-        break;
     case CAT_VAR_BUF_HEX:
-        stat = parse_buffer_hexadecimal(self);
-        if (stat < 0)
-        {
-            ack_error(self);
-            return CAT_STATUS_BUSY;
-        }
-        break;
+        return parse_buffer_hexadecimal_char(self, ch);
     case CAT_VAR_BUF_STRING:
-        stat = parse_buffer_string(self);
-        if (stat < 0)
-        {
-            ack_error(self);
-            return CAT_STATUS_BUSY;
-        }
-        break;
+        return parse_buffer_string_char(self, ch);
+    case CAT_VAR_BUF_BASE64:
+        return parse_buffer_base64_char(self, ch);
     default:
-        return CAT_STATUS_ERROR;
+        break;
     }
+    return -1;
+}
 
-    if ((self->var->write != NULL) && (self->var->write(self->var, self->write_size) != 0))
-    {
-        ack_error(self);
-        return CAT_STATUS_BUSY;
-    }
+static void parse_buffer_hexadecimal_run(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    size_t n;
+
+    if ((self->arg_state != 0) || (self->var->access == CAT_VAR_ACCESS_READ_ONLY) || (self->position >= self->length))
+        return;
+
+    /* whole bytes are decoded at once, until first not hex char (spaces and separators are parsed by char) */
+    n = (self->length - self->position) >> 1;
+    if (n > (self->var->data_size - self->arg_size))
+        n = self->var->data_size - self->arg_size;
+
+    n = decode_hex(&((uint8_t*) (self->var->data))[self->arg_size], &get_atcmd_buf(self)[self->position], n);
+    self->arg_size += n;
+    self->position += 2U * n;
+}
+
+static void parse_buffer_base64_run(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    size_t n;
+
+    if ((self->arg_state != 0) || (self->var->access == CAT_VAR_ACCESS_READ_ONLY) || (self->position >= self->length))
+        return;
+
+    /* whole not padded quads are decoded at once, padded quad and separators are parsed by char */
+    n = (self->length - self->position) >> 2;
+    if (n > ((self->var->data_size - self->arg_size) / 3U))
+        n = (self->var->data_size - self->arg_size) / 3U;
+
+    n = decode_base64(&((uint8_t*) (self->var->data))[self->arg_size], &get_atcmd_buf(self)[self->position], n);
+    self->arg_size += 3U * n;
+    self->position += 4U * n;
+}
 
-    if ((++self->index < self->cmd->var_num) && (stat > 0))
+static int parse_buffer(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    int stat;
+
+    do
     {
-        self->var = &self->cmd->var[self->index];
-        return CAT_STATUS_BUSY;
-    }
+        if (self->var->type == CAT_VAR_BUF_HEX)
+            parse_buffer_hexadecimal_run(self);
+        else if (self->var->type == CAT_VAR_BUF_BASE64)
+            parse_buffer_base64_run(self);
+
+        stat = parse_buffer_char(self, get_atcmd_buf(self)[self->position++]);
+    } while (stat == CAT_PARSE_ARG_MORE);
+
+    return stat;
+}
+
+/* delimits string argument in working buffer (quotes stripped, escape sequences only skipped over, not decoded) */
+static int parse_string_token(struct cat_object* self, size_t* start, size_t* end)
+{
+    assert(self != NULL);
+
+    char* buf = get_atcmd_buf(self);
+    char  ch;
+
+    while (buf[self->position] == ' ')
+        self->position++;
+
+    if (buf[self->position] == '"')
+        self->position++;
+
+    *start = self->position;
+    while (1)
+    {
+        ch = buf[self->position];
+        if ((ch == 0) || (ch == ',') || (ch == '"'))
+            break;
+        if (ch == '\\')
+        {
+            /* only escape sequences accepted by string variable parser */
+            ch = buf[self->position + 1U];
+            if ((ch != '\\') && (ch != '"') && (ch != 'n'))
+                return -1;
+            self->position++;
+        }
+        self->position++;
+    }
+    *end = self->position++;
+
+    if (ch == '"')
+    {
+        ch = buf[self->position++];
+        if ((ch != 0) && (ch != ','))
+            return -1;
+    }
+    else if (*end == *start)
+    {
+        return -1;
+    }
+
+    return (ch == ',') ? 1 : 0;
+}
+
+static int parse_buffer_view(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    size_t start;
+    size_t end;
+    int    stat;
+
+    stat = parse_string_token(self, &start, &end);
+    if (stat < 0)
+        return -1;
+
+    if (self->var->access == CAT_VAR_ACCESS_READ_ONLY)
+    {
+        self->write_size = 0;
+    }
+    else
+    {
+        ((struct cat_buf_view*) self->var->data)->data = &get_atcmd_buf(self)[start];
+        ((struct cat_buf_view*) self->var->data)->size = end - start;
+        self->write_size                               = end - start;
+    }
+    return stat;
+}
+
+static size_t get_skip_fields_num(struct cat_variable const* var)
+{
+    return (var->data_size > 0) ? var->data_size : 1U;
+}
+
+static int parse_skip(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    char ch;
+
+    /* fields are passed over without any validation, only separators are counted */
+    self->write_size = 0;
+    while (1)
+    {
+        ch = get_atcmd_buf(self)[self->position++];
+        if (ch == 0)
+            return 0;
+        if ((ch == ',') && (++self->arg_size >= get_skip_fields_num(self->var)))
+            return 1;
+    }
+}
+
+static int parse_fixed_decimal(struct cat_object* self, int64_t* ret)
+{
+    assert(self != NULL);
+    assert(ret != NULL);
+    assert(self->var->scale <= CAT_FIXED_DEC_MAX_SCALE);
+
+    char     ch;
+    uint64_t val    = 0;
+    int64_t  sign   = 0;
+    size_t   frac   = 0;
+    bool     point  = false;
+    bool     digits = false;
+    bool     round  = false;
+
+    while (1)
+    {
+        ch = get_atcmd_buf(self)[self->position++];
+        if (ch == ' ')
+            continue; //!< skip space
+        if ((ch == 0) || (ch == ','))
+        {
+            if (digits == false)
+                return -1;
+
+            /* missing fraction digits are zeros, first digit behind scale rounds half away from zero */
+            for (; frac < self->var->scale; frac++)
+            {
+                if (accumulate_dec_digit(&val, '0') != 0)
+                    return -1;
+            }
+            if ((round != false) && (++val == 0))
+                return -1;
+
+            if (val > ((sign < 0) ? ((uint64_t) INT64_MAX + 1U) : (uint64_t) INT64_MAX))
+                return -1;
+            *ret = (sign < 0) ? (-(int64_t) (val - 1U) - 1) : (int64_t) val;
+            return (ch == ',') ? 1 : 0;
+        }
+
+        if (((ch == '-') || (ch == '+')) && (sign == 0) && (digits == false) && (point == false))
+        {
+            sign = (ch == '-') ? -1 : 1;
+        }
+        else if ((ch == '.') && (point == false))
+        {
+            point = true;
+        }
+        else if (is_valid_dec_char(ch) != 0)
+        {
+            digits = true;
+            if ((point == false) || (frac < self->var->scale))
+            {
+                if (accumulate_dec_digit(&val, ch) != 0)
+                    return -1;
+                if (point != false)
+                    frac++;
+            }
+            else if (frac == self->var->scale)
+            {
+                round = (ch >= '5');
+                frac++;
+            }
+        }
+        else
+        {
+            return -1;
+        }
+    }
+
+    return -1;
+}
+
+static int validate_int_range(struct cat_object* self, int64_t val)
+{
+    if (self->var->access == CAT_VAR_ACCESS_READ_ONLY)
+    {
+        self->write_size = 0;
+        return 0;
+    }
+
+    switch (self->var->data_size)
+    {
+    case 1:
+        if ((val < INT8_MIN) || (val > INT8_MAX))
+            return -1;
+        *(int8_t*) (self->var->data) = val;
+        break;
+    case 2:
+        if ((val < INT16_MIN) || (val > INT16_MAX))
+            return -1;
+        *(int16_t*) (self->var->data) = val;
+        break;
+    case 4:
+        if ((val < INT32_MIN) || (val > INT32_MAX))
+            return -1;
+        *(int32_t*) (self->var->data) = val;
+        break;
+    case 8:
+        *(int64_t*) (self->var->data) = val;
+        break;
+    default:
+        return -1;
+    }
+    self->write_size = self->var->data_size;
+    return 0;
+}
+
+static int validate_uint_range(struct cat_object* self, uint64_t val)
+{
+    if (self->var->access == CAT_VAR_ACCESS_READ_ONLY)
+    {
+        self->write_size = 0;
+        return 0;
+    }
+
+    switch (self->var->data_size)
+    {
+    case 1:
+        if (val > UINT8_MAX)
+            return -1;
+        *(uint8_t*) (self->var->data) = val;
+        break;
+    case 2:
+        if (val > UINT16_MAX)
+            return -1;
+        *(uint16_t*) (self->var->data) = val;
+        break;
+    case 4:
+        if (val > UINT32_MAX)
+            return -1;
+        *(uint32_t*) (self->var->data) = val;
+        break;
+    case 8:
+        *(uint64_t*) (self->var->data) = val;
+        break;
+    default:
+        return -1;
+    }
+    self->write_size = self->var->data_size;
+    return 0;
+}
+
+static int parse_enum(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    size_t start;
+    size_t end;
+    size_t index;
+    int    stat;
+
+    assert(self->var->keywords != NULL);
+
+    stat = parse_string_token(self, &start, &end);
+    if ((stat < 0) || (find_enum_keyword(self->var->keywords, &get_atcmd_buf(self)[start], end - start, &index) != 0))
+        return -1;
+
+    if (validate_uint_range(self, index) != 0)
+        return -1;
+    return stat;
+}
+
+static int parse_var(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    int64_t val;
+    int     stat;
+
+    switch (self->var->type)
+    {
+    case CAT_VAR_INT_DEC:
+        stat = parse_int_decimal(self, &val);
+        if ((stat < 0) || (validate_int_range(self, val) != 0))
+            return -1;
+        return stat;
+    case CAT_VAR_UINT_DEC:
+        stat = parse_uint_decimal(self, (uint64_t*) &val);
+        if ((stat < 0) || (validate_uint_range(self, val) != 0))
+            return -1;
+        return stat;
+    case CAT_VAR_NUM_HEX:
+        stat = parse_num_hexadecimal(self, (uint64_t*) &val);
+        if ((stat < 0) || (validate_uint_range(self, val) != 0))
+            return -1;
+        return stat;
+    case CAT_VAR_BUF_HEX:
+    case CAT_VAR_BUF_STRING:
+    case CAT_VAR_BUF_BASE64:
+        return parse_buffer(self);
+    case CAT_VAR_BUF_VIEW:
+        return parse_buffer_view(self);
+    case CAT_VAR_SKIP:
+        return parse_skip(self);
+    case CAT_VAR_ENUM:
+        return parse_enum(self);
+    case CAT_VAR_FIXED_DEC:
+        stat = parse_fixed_decimal(self, &val);
+        if ((stat < 0) || (validate_int_range(self, val) != 0))
+            return -1;
+        return stat;
+    default:
+        break;
+    }
+    return -2;
+}
+
+static bool is_repeat_element_complete(struct cat_object* self)
+{
+    return ((self->index - self->cmd->var_num) % self->cmd->repeat_var_num) == 0;
+}
+
+static int next_write_var(struct cat_object* self, int stat)
+{
+    assert(self != NULL);
+
+    if ((self->var->write != NULL) && (self->var->write(self->var, self->write_size) != 0))
+        return -1;
+
+    if ((++self->index > self->cmd->var_num) && (is_repeat_element_complete(self) != false))
+    {
+        if ((self->cmd->element != NULL) && (self->cmd->element(self->cmd, (self->index - self->cmd->var_num) / self->cmd->repeat_var_num - 1U) != 0))
+            return -1;
+    }
+
+    if (stat > 0)
+    {
+        if ((self->index >= self->cmd->var_num) && (self->cmd->repeat_var_num == 0))
+            return -1;
+
+        self->var = get_write_var(self->cmd, self->index);
+        start_parse_var(self);
+        return 1;
+    }
+
+    if ((self->cmd->need_all_vars != false) && (self->index < self->cmd->var_num))
+        return -1;
+
+    /* arguments line can end only after whole repeated element */
+    if ((self->index > self->cmd->var_num) && (is_repeat_element_complete(self) == false))
+        return -1;
+
+    return 0;
+}
+
+static void start_write_loop(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    if (self->cmd->write == NULL)
+    {
+        ack_ok(self);
+        return;
+    }
+
+    self->state = CAT_STATE_WRITE_LOOP;
+}
+
+static void start_capture(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    struct cat_variable const* var = &self->cmd->var[self->cmd->capture_var];
+
+    if (self->index <= self->cmd->capture_var)
+    {
+        ack_error(self);
+        return;
+    }
+
+    switch (var->data_size)
+    {
+    case 1:
+        self->capture_left = *(uint8_t*) (var->data);
+        break;
+    case 2:
+        self->capture_left = *(uint16_t*) (var->data);
+        break;
+    case 4:
+        self->capture_left = *(uint32_t*) (var->data);
+        break;
+    case 8:
+#if SIZE_MAX < UINT64_MAX
+        if (*(uint64_t*) (var->data) > SIZE_MAX)
+        {
+            ack_error(self);
+            return;
+        }
+#endif
+        self->capture_left = (size_t) (*(uint64_t*) (var->data));
+        break;
+    default:
+        ack_error(self);
+        return;
+    }
+
+    self->state = CAT_STATE_CAPTURE_DATA;
+}
+
+static void finish_write_args(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    if (self->cmd->capture_ring != NULL)
+    {
+        start_capture(self);
+        return;
+    }
+
+    start_write_loop(self);
+}
+
+static cat_status parse_write_args(struct cat_object* self)
+{
+    int stat;
+
+    assert(self != NULL);
+
+    stat = parse_var(self);
+    if (stat == -2)
+        return CAT_STATUS_ERROR;
+
+    if (stat >= 0)
+        stat = next_write_var(self, stat);
+
+    if (stat < 0)
+        ack_error(self);
+    else if (stat == 0)
+        finish_write_args(self);
+
+    return CAT_STATUS_BUSY;
+}
+
+static int print_int_to_buf(struct cat_object* self, int64_t val, cat_fsm_type fsm)
+{
+    char   tmp[CAT_NUM_STR_MAX];
+    size_t n;
+
+    n = convert_int_to_dec(&tmp[sizeof(tmp)], val);
+    return print_nstring_to_buf(self, &tmp[sizeof(tmp) - n], n, fsm);
+}
+
+static int print_uint_to_buf(struct cat_object* self, uint64_t val, cat_fsm_type fsm)
+{
+    char   tmp[CAT_NUM_STR_MAX];
+    size_t n;
+
+    n = convert_uint_to_dec(&tmp[sizeof(tmp)], val);
+    return print_nstring_to_buf(self, &tmp[sizeof(tmp) - n], n, fsm);
+}
+
+static int format_int_decimal(struct cat_object* self, cat_fsm_type fsm)
+{
+    int64_t val;
+
+    assert(self != NULL);
+    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+
+    struct cat_variable* var = get_var_by_fsm(self, fsm);
+
+    switch (var->data_size)
+    {
+    case 1:
+        val = *(int8_t*) var->data;
+        break;
+    case 2:
+        val = *(int16_t*) var->data;
+        break;
+    case 4:
+        val = *(int32_t*) var->data;
+        break;
+    case 8:
+        val = *(int64_t*) var->data;
+        break;
+    default:
+        return -1;
+    }
+
+    if (var->access == CAT_VAR_ACCESS_WRITE_ONLY)
+        val = 0;
+
+    if (print_int_to_buf(self, val, fsm) != 0)
+        return -1;
+
+    return 0;
+}
+
+static int format_uint_decimal(struct cat_object* self, cat_fsm_type fsm)
+{
+    uint64_t val;
+
+    assert(self != NULL);
+    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+
+    struct cat_variable* var = get_var_by_fsm(self, fsm);
+
+    switch (var->data_size)
+    {
+    case 1:
+        val = *(uint8_t*) var->data;
+        break;
+    case 2:
+        val = *(uint16_t*) var->data;
+        break;
+    case 4:
+        val = *(uint32_t*) var->data;
+        break;
+    case 8:
+        val = *(uint64_t*) var->data;
+        break;
+    default:
+        return -1;
+    }
+
+    if (var->access == CAT_VAR_ACCESS_WRITE_ONLY)
+        val = 0;
+
+    if (print_uint_to_buf(self, val, fsm) != 0)
+        return -1;
+
+    return 0;
+}
+
+static int format_num_hexadecimal(struct cat_object* self, cat_fsm_type fsm)
+{
+    uint64_t val;
+    char     tmp[CAT_NUM_STR_MAX];
+
+    assert(self != NULL);
+    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+
+    struct cat_variable* var = get_var_by_fsm(self, fsm);
+
+    switch (var->data_size)
+    {
+    case 1:
+        val = *(uint8_t*) var->data;
+        break;
+    case 2:
+        val = *(uint16_t*) var->data;
+        break;
+    case 4:
+        val = *(uint32_t*) var->data;
+        break;
+    case 8:
+        val = *(uint64_t*) var->data;
+        break;
+    default:
+        return -1;
+    }
+
+    if (var->access == CAT_VAR_ACCESS_WRITE_ONLY)
+        val = 0;
+
+    if (print_nstring_to_buf(self, tmp, convert_uint_to_hex(tmp, val, var->data_size), fsm) != 0)
+        return -1;
+
+    return 0;
+}
+
+static int format_buffer_hexadecimal(struct cat_object* self, cat_fsm_type fsm)
+{
+    char* dst;
+
+    assert(self != NULL);
+    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+
+    struct cat_variable* var = get_var_by_fsm(self, fsm);
+
+    if ((2U * var->data_size) >= get_left_buffer_space_by_fsm(self, fsm))
+        return -1;
+
+    dst = get_current_buffer_by_fsm(self, fsm);
+    if (var->access == CAT_VAR_ACCESS_WRITE_ONLY)
+    {
+        memset(dst, '0', 2U * var->data_size);
+    }
+    else
+    {
+        encode_hex(dst, var->data, var->data_size);
+    }
+
+    move_position_by_fsm(self, 2U * var->data_size, fsm);
+    get_current_buffer_by_fsm(self, fsm)[0] = 0;
+    return 0;
+}
+
+static int format_buffer_base64(struct cat_object* self, cat_fsm_type fsm)
+{
+    char*  dst;
+    size_t len;
+
+    assert(self != NULL);
+    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+
+    struct cat_variable* var = get_var_by_fsm(self, fsm);
+
+    len = 4U * ((var->data_size + 2U) / 3U);
+    if (len >= get_left_buffer_space_by_fsm(self, fsm))
+        return -1;
+
+    dst = get_current_buffer_by_fsm(self, fsm);
+    if (var->access == CAT_VAR_ACCESS_WRITE_ONLY)
+    {
+        memset(dst, 'A', len);
+        if ((var->data_size % 3U) != 0)
+            memset(&dst[len - 3U + (var->data_size % 3U)], '=', 3U - (var->data_size % 3U));
+    }
+    else
+    {
+        encode_base64(dst, var->data, var->data_size);
+    }
+
+    move_position_by_fsm(self, len, fsm);
+    get_current_buffer_by_fsm(self, fsm)[0] = 0;
+    return 0;
+}
+
+static int print_quoted_string_to_buf(struct cat_object* self, const char* buf, size_t len, cat_fsm_type fsm)
+{
+    size_t i = 0;
+    size_t n = 0;
+    size_t run;
+    size_t size;
+    char*  out;
+
+    assert(self != NULL);
+    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+
+    out  = get_current_buffer_by_fsm(self, fsm);
+    size = get_left_buffer_space_by_fsm(self, fsm);
+
+    /* escaping only grows string, so quoted raw string with terminator must fit at least */
+    if (len + 2U >= size)
+        return -1;
+
+    out[n++] = '"';
+    while (i < len)
+    {
+        run = find_string_escape(&buf[i], len - i);
+        if (n + run + 2U >= size)
+            return -1;
+        memcpy(&out[n], &buf[i], run);
+        n += run;
+        i += run;
+
+        if (i < len)
+        {
+            if (n + 3U >= size)
+                return -1;
+            out[n++] = '\\';
+            out[n++] = string_escapes[(uint8_t) buf[i++]];
+        }
+    }
+    out[n++] = '"';
+    out[n]   = '\0';
+
+    move_position_by_fsm(self, n, fsm);
+    return 0;
+}
+
+static int format_buffer_string(struct cat_object* self, cat_fsm_type fsm)
+{
+    size_t      len;
+    const char* buf;
+    const char* end;
 
-    if (stat > 0)
-    {
-        ack_error(self);
-        return CAT_STATUS_BUSY;
-    }
+    assert(self != NULL);
+    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
 
-    if ((self->cmd->need_all_vars != false) && (self->index != self->cmd->var_num))
+    struct cat_variable* var = get_var_by_fsm(self, fsm);
+
+    buf = var->data;
+    if (var->access == CAT_VAR_ACCESS_WRITE_ONLY)
     {
-        ack_error(self);
-        return CAT_STATUS_BUSY;
+        len = 0;
     }
-
-    if (self->cmd->write == NULL)
+    else
     {
-        ack_ok(self);
-        return CAT_STATUS_BUSY;
+        end = memchr(buf, 0, var->data_size);
+        len = (end != NULL) ? (size_t) (end - buf) : var->data_size;
     }
 
-    self->state = CAT_STATE_WRITE_LOOP;
-    return CAT_STATUS_BUSY;
+    return print_quoted_string_to_buf(self, buf, len, fsm);
 }
 
-static int print_format_num(struct cat_object* self, char* fmt, uint32_t val, cat_fsm_type fsm)
+static int format_buffer_view(struct cat_object* self, cat_fsm_type fsm)
 {
-    int    written;
-    size_t len;
-
     assert(self != NULL);
     assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
 
-    len     = get_left_buffer_space_by_fsm(self, fsm);
-    written = snprintf(get_current_buffer_by_fsm(self, fsm), len, fmt, val);
+    struct cat_variable*       var  = get_var_by_fsm(self, fsm);
+    struct cat_buf_view const* view = var->data;
 
-    if ((written < 0) || ((size_t) written >= len))
-        return -1;
+    if ((var->access == CAT_VAR_ACCESS_WRITE_ONLY) || (view->data == NULL))
+        return print_quoted_string_to_buf(self, "", 0, fsm);
 
-    move_position_by_fsm(self, written, fsm);
-    return 0;
+    return print_quoted_string_to_buf(self, view->data, view->size, fsm);
 }
 
-static int format_int_decimal(struct cat_object* self, cat_fsm_type fsm)
+static int format_skip(struct cat_object* self, cat_fsm_type fsm)
 {
-    int32_t val;
+    size_t i;
 
     assert(self != NULL);
     assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
 
-    struct cat_variable* var = get_var_by_fsm(self, fsm);
-
-    switch (var->data_size)
+    /* skipped fields are printed empty */
+    for (i = 1; i < get_skip_fields_num(get_var_by_fsm(self, fsm)); i++)
     {
-    case 1:
-        val = *(int8_t*) var->data;
-        break;
-    case 2:
-        val = *(int16_t*) var->data;
-        break;
-    case 4:
-        val = *(int32_t*) var->data;
-        break;
-    default:
-        return -1;
+        if (print_string_to_buf(self, ",", fsm) != 0)
+            return -1;
     }
-
-    if (var->access == CAT_VAR_ACCESS_WRITE_ONLY)
-        val = 0;
-
-    if (print_format_num(self, "%d", val, fsm) != 0)
-        return -1;
-
     return 0;
 }
 
-static int format_uint_decimal(struct cat_object* self, cat_fsm_type fsm)
+static int format_enum(struct cat_object* self, cat_fsm_type fsm)
 {
-    uint32_t val;
+    uint64_t val;
 
     assert(self != NULL);
     assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
 
     struct cat_variable* var = get_var_by_fsm(self, fsm);
 
+    assert(var->keywords != NULL);
+
     switch (var->data_size)
     {
     case 1:
@@ -1702,6 +3326,9 @@ static int format_uint_decimal(struct cat_object* self, cat_fsm_type fsm)
     case 4:
         val = *(uint32_t*) var->data;
         break;
+    case 8:
+        val = *(uint64_t*) var->data;
+        break;
     default:
         return -1;
     }
@@ -1709,35 +3336,41 @@ static int format_uint_decimal(struct cat_object* self, cat_fsm_type fsm)
     if (var->access == CAT_VAR_ACCESS_WRITE_ONLY)
         val = 0;
 
-    if (print_format_num(self, "%u", val, fsm) != 0)
+    if (val >= var->keywords->num)
         return -1;
 
-    return 0;
+    return print_string_to_buf(self, var->keywords->names[val], fsm);
 }
 
-static int format_num_hexadecimal(struct cat_object* self, cat_fsm_type fsm)
+static int format_fixed_decimal(struct cat_object* self, cat_fsm_type fsm)
 {
-    uint32_t val;
-    char     fstr[8];
+    int64_t  val;
+    uint64_t mag;
+    uint64_t div = 1;
+    size_t   i;
+    char     tmp[CAT_NUM_STR_MAX + 2U];
+    char*    p = &tmp[sizeof(tmp)];
 
     assert(self != NULL);
     assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
 
     struct cat_variable* var = get_var_by_fsm(self, fsm);
 
+    assert(var->scale <= CAT_FIXED_DEC_MAX_SCALE);
+
     switch (var->data_size)
     {
     case 1:
-        val = *(uint8_t*) var->data;
-        strcpy(fstr, "0x%02X");
+        val = *(int8_t*) var->data;
         break;
     case 2:
-        val = *(uint16_t*) var->data;
-        strcpy(fstr, "0x%04X");
+        val = *(int16_t*) var->data;
         break;
     case 4:
-        val = *(uint32_t*) var->data;
-        strcpy(fstr, "0x%08X");
+        val = *(int32_t*) var->data;
+        break;
+    case 8:
+        val = *(int64_t*) var->data;
         break;
     default:
         return -1;
@@ -1746,97 +3379,23 @@ static int format_num_hexadecimal(struct cat_object* self, cat_fsm_type fsm)
     if (var->access == CAT_VAR_ACCESS_WRITE_ONLY)
         val = 0;
 
-    if (print_format_num(self, fstr, val, fsm) != 0)
-        return -1;
-
-    return 0;
-}
-
-static int format_buffer_hexadecimal(struct cat_object* self, cat_fsm_type fsm)
-{
-    size_t   i;
-    uint8_t* buf;
-    uint8_t  val;
-
-    assert(self != NULL);
-    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
-
-    struct cat_variable* var = get_var_by_fsm(self, fsm);
-
-    buf = var->data;
-    for (i = 0; i < var->data_size; i++)
-    {
-        if (var->access == CAT_VAR_ACCESS_WRITE_ONLY)
-        {
-            val = 0;
-        }
-        else
-        {
-            val = buf[i];
-        }
-
-        if (print_format_num(self, "%02X", val, fsm) != 0)
-            return -1;
-    }
-    return 0;
-}
-
-static int format_buffer_string(struct cat_object* self, cat_fsm_type fsm)
-{
-    size_t i = 0;
-    char*  buf;
-    size_t buf_size;
-    char   ch;
-
-    assert(self != NULL);
-    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
-
-    struct cat_variable* var = get_var_by_fsm(self, fsm);
-
-    if (var->access == CAT_VAR_ACCESS_WRITE_ONLY)
-    {
-        buf_size = 0;
-    }
-    else
-    {
-        buf_size = var->data_size;
-    }
-
-    if (print_string_to_buf(self, "\"", fsm) != 0)
-        return -1;
+    for (i = 0; i < var->scale; i++)
+        div *= 10U;
 
-    buf = var->data;
-    for (i = 0; i < buf_size; i++)
+    /* string is built backward: zero padded fraction, point, integer part and sign */
+    mag = (val < 0) ? ((uint64_t) 0 - (uint64_t) val) : (uint64_t) val;
+    if (var->scale > 0)
     {
-        ch = buf[i];
-        if (ch == 0)
-            break;
-        if (ch == '\\')
-        {
-            if (print_string_to_buf(self, "\\\\", fsm) != 0)
-                return -1;
-        }
-        else if (ch == '"')
-        {
-            if (print_string_to_buf(self, "\\\"", fsm) != 0)
-                return -1;
-        }
-        else if (ch == '\n')
-        {
-            if (print_string_to_buf(self, "\\n", fsm) != 0)
-                return -1;
-        }
-        else
-        {
-            if (print_nstring_to_buf(self, &ch, 1, fsm) != 0)
-                return -1;
-        }
+        p -= convert_uint_to_dec(p, mag % div);
+        while ((size_t) (&tmp[sizeof(tmp)] - p) < var->scale)
+            *--p = '0';
+        *--p = '.';
     }
+    p -= convert_uint_to_dec(p, mag / div);
+    if (val < 0)
+        *--p = '-';
 
-    if (print_string_to_buf(self, "\"", fsm) != 0)
-        return -1;
-
-    return 0;
+    return print_nstring_to_buf(self, p, (size_t) (&tmp[sizeof(tmp)] - p), fsm);
 }
 
 static int format_info_type(struct cat_object* self, cat_fsm_type fsm)
@@ -1879,6 +3438,9 @@ static int format_info_type(struct cat_object* self, cat_fsm_type fsm)
         case 4:
             strcpy(var_type, "INT32");
             break;
+        case 8:
+            strcpy(var_type, "INT64");
+            break;
         default:
             return -1;
         }
@@ -1895,6 +3457,9 @@ static int format_info_type(struct cat_object* self, cat_fsm_type fsm)
         case 4:
             strcpy(var_type, "UINT32");
             break;
+        case 8:
+            strcpy(var_type, "UINT64");
+            break;
         default:
             return -1;
         }
@@ -1911,6 +3476,9 @@ static int format_info_type(struct cat_object* self, cat_fsm_type fsm)
         case 4:
             strcpy(var_type, "HEX32");
             break;
+        case 8:
+            strcpy(var_type, "HEX64");
+            break;
         default:
             return -1;
         }
@@ -1919,8 +3487,21 @@ static int format_info_type(struct cat_object* self, cat_fsm_type fsm)
         strcpy(var_type, "HEXBUF");
         break;
     case CAT_VAR_BUF_STRING:
+    case CAT_VAR_BUF_VIEW:
         strcpy(var_type, "STRING");
         break;
+    case CAT_VAR_SKIP:
+        strcpy(var_type, "SKIP");
+        break;
+    case CAT_VAR_ENUM:
+        strcpy(var_type, "ENUM");
+        break;
+    case CAT_VAR_FIXED_DEC:
+        strcpy(var_type, "FIXED");
+        break;
+    case CAT_VAR_BUF_BASE64:
+        strcpy(var_type, "BASE64");
+        break;
     default:
         return -1;
     }
@@ -2022,6 +3603,21 @@ static cat_status format_read_args(struct cat_object* self, cat_fsm_type fsm)
     case CAT_VAR_BUF_STRING:
         stat = format_buffer_string(self, fsm);
         break;
+    case CAT_VAR_BUF_BASE64:
+        stat = format_buffer_base64(self, fsm);
+        break;
+    case CAT_VAR_BUF_VIEW:
+        stat = format_buffer_view(self, fsm);
+        break;
+    case CAT_VAR_SKIP:
+        stat = format_skip(self, fsm);
+        break;
+    case CAT_VAR_ENUM:
+        stat = format_enum(self, fsm);
+        break;
+    case CAT_VAR_FIXED_DEC:
+        stat = format_fixed_decimal(self, fsm);
+        break;
     default:
         return CAT_STATUS_ERROR;
     }
@@ -2092,6 +3688,56 @@ static cat_status format_test_args(struct cat_object* self, cat_fsm_type fsm)
     return CAT_STATUS_BUSY;
 }
 
+static int parse_stream_arg_char(struct cat_object* self, char ch)
+{
+    assert(self != NULL);
+
+    int stat;
+
+    if (self->var == NULL)
+    {
+        self->index = 0;
+        self->var   = get_write_var(self->cmd, self->index);
+        start_parse_var(self);
+    }
+
+    if (self->var->type == CAT_VAR_SKIP)
+    {
+        /* skipped field chars are dropped as they arrive */
+        if ((ch != 0) && (ch != ','))
+            return 1;
+        if ((ch == ',') && (++self->arg_size < get_skip_fields_num(self->var)))
+            return 1;
+        self->write_size = 0;
+        stat             = (ch == ',') ? 1 : 0;
+    }
+    else if (is_buffer_var(self->var) != false)
+    {
+        stat = parse_buffer_char(self, ch);
+        if (stat == CAT_PARSE_ARG_MORE)
+            return 1;
+    }
+    else
+    {
+        if ((self->length + 1) >= get_atcmd_buf_size(self))
+            return -1;
+
+        get_atcmd_buf(self)[self->length++] = ch;
+        get_atcmd_buf(self)[self->length]   = 0;
+        if ((ch != 0) && (ch != ','))
+            return 1;
+
+        self->position = 0;
+        self->length   = 0;
+        stat           = parse_var(self);
+    }
+
+    if (stat < 0)
+        return -1;
+
+    return next_write_var(self, stat);
+}
+
 static cat_status parse_command_args(struct cat_object* self)
 {
     assert(self != NULL);
@@ -2107,12 +3753,24 @@ static cat_status parse_command_args(struct cat_object* self)
             ack_error(self);
             break;
         }
-        if (is_variables_access_possible(self, self->cmd, CAT_VAR_ACCESS_WRITE_ONLY) != false)
+        if (self->stream_args_flag != false)
+        {
+            if (parse_stream_arg_char(self, 0) != 0)
+            {
+                ack_error(self);
+                break;
+            }
+            self->length = 0;
+            finish_write_args(self);
+            break;
+        }
+        if (is_write_args_possible(self, self->cmd) != false)
         {
             self->state    = CAT_STATE_PARSE_WRITE_ARGS;
             self->position = 0;
             self->index    = 0;
-            self->var      = &self->cmd->var[self->index];
+            self->var      = get_write_var(self->cmd, self->index);
+            start_parse_var(self);
             break;
         }
         if (self->cmd->write == NULL)
@@ -2127,7 +3785,7 @@ static cat_status parse_command_args(struct cat_object* self)
         self->cr_flag = true;
         break;
     default:
-        if ((self->length == 0) && (self->current_char == '?'))
+        if ((self->length == 0) && (self->var == NULL) && (self->current_char == '?'))
         {
             if (((self->cmd->test != NULL) || ((self->cmd->var != NULL) && (self->cmd->var_num > 0))) && (self->cmd->implicit_write == false))
             {
@@ -2137,6 +3795,13 @@ static cat_status parse_command_args(struct cat_object* self)
             }
         }
 
+        if (self->stream_args_flag != false)
+        {
+            if ((self->current_char == 0) || (parse_stream_arg_char(self, self->current_char) <= 0))
+                self->state = CAT_STATE_ERROR;
+            break;
+        }
+
         if (self->length >= get_atcmd_buf_size(self))
         {
             self->state = CAT_STATE_ERROR;
@@ -2172,6 +3837,9 @@ cat_status cat_trigger_unsolicited_event(struct cat_object* self, struct cat_com
     if ((self->mutex != NULL) && (self->mutex->unlock() != 0))
         return CAT_STATUS_ERROR_MUTEX_UNLOCK;
 
+    if (s == CAT_STATUS_OK)
+        notify(self);
+
     return s;
 }
 
@@ -2243,13 +3911,15 @@ static cat_status process_idle_state(struct cat_object* self)
     return CAT_STATUS_BUSY;
 }
 
-static void enable_hold_state(struct cat_object* self)
+static void enable_hold_state(struct cat_object* self, struct cat_command const* cmd)
 {
     assert(self != NULL);
 
     self->state            = CAT_STATE_HOLD;
     self->hold_state_flag  = true;
     self->hold_exit_status = 0;
+    self->hold_start_ms    = self->now_ms;
+    self->hold_timeout_ms  = ((cmd != NULL) && (cmd->hold_timeout_ms != 0)) ? cmd->hold_timeout_ms : self->desc->hold_timeout_ms;
 }
 
 static cat_status hold_exit(struct cat_object* self, cat_status status)
@@ -2363,7 +4033,7 @@ static void print_cmd_list(struct cat_object* self)
         self->cmd_type = CAT_CMD_TYPE_WRITE;
         break;
     case CAT_CMD_TYPE_WRITE:
-        if (self->cmd->write != NULL || (is_variables_access_possible(self, self->cmd, CAT_VAR_ACCESS_WRITE_ONLY) != false))
+        if (self->cmd->write != NULL || (is_write_args_possible(self, self->cmd) != false))
         {
             self->position = 0;
             if (print_current_cmd_full_name(self, "=") != 0)
@@ -2398,10 +4068,175 @@ static void print_cmd_list(struct cat_object* self)
     }
 }
 
+static void start_data_phase(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    if (self->data_phase_flag == false)
+    {
+        ack_error(self);
+        return;
+    }
+    self->data_phase_flag = false;
+
+    reset_position(self, CAT_FSM_TYPE_ATCMD);
+    if ((print_string_to_buf(self, get_new_line_chars(self), CAT_FSM_TYPE_ATCMD) != 0) || (print_string_to_buf(self, "> ", CAT_FSM_TYPE_ATCMD) != 0))
+    {
+        ack_error(self);
+        return;
+    }
+
+    start_flush_io_buffer_raw(self, CAT_STATE_DATA_PHASE);
+}
+
+static void pass_data_phase_buf(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    if ((self->data_phase.handler == NULL) || (self->data_fill == 0))
+        return;
+
+    if ((self->data_error == false) && (self->data_phase.handler(self->data_phase.buf, self->data_fill, self->data_position - self->data_fill) != 0))
+        self->data_error = true;
+
+    self->data_fill = 0;
+}
+
+static size_t receive_data_phase(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    size_t         n = self->data_phase.size - self->data_position;
+    const uint8_t* data;
+
+    if (self->feed_data == NULL)
+    {
+        n = 0;
+        while ((self->data_position < self->data_phase.size) && (self->data_fill < self->data_phase.buf_size) && (read_char(self) != 0))
+        {
+            self->data_phase.buf[self->data_fill++] = (uint8_t) self->current_char;
+            self->data_position++;
+            n++;
+        }
+
+        if (self->data_fill >= self->data_phase.buf_size)
+            pass_data_phase_buf(self);
+        return n;
+    }
+
+    /* pushed data is passed to handler directly, without copying */
+    if (n > (self->feed_size - self->feed_position))
+        n = self->feed_size - self->feed_position;
+    if (n == 0)
+        return 0;
+
+    data = &self->feed_data[self->feed_position];
+    self->feed_position += n;
+    self->last_char_ms = self->now_ms;
+
+    if (self->data_phase.handler == NULL)
+    {
+        memcpy(&self->data_phase.buf[self->data_fill], data, n);
+        self->data_fill += n;
+        self->data_position += n;
+        return n;
+    }
+
+    pass_data_phase_buf(self);
+    if ((self->data_error == false) && (self->data_phase.handler(data, n, self->data_position) != 0))
+        self->data_error = true;
+    self->data_position += n;
+    return n;
+}
+
+static cat_status process_data_phase(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    if ((receive_data_phase(self) == 0) && (self->data_position < self->data_phase.size))
+    {
+        self->input_starved = true;
+        return CAT_STATUS_OK;
+    }
+
+    if (self->data_position < self->data_phase.size)
+        return CAT_STATUS_BUSY;
+
+    pass_data_phase_buf(self);
+    if (self->data_error != false)
+    {
+        ack_error(self);
+    }
+    else
+    {
+        ack_ok(self);
+    }
+    return CAT_STATUS_BUSY;
+}
+
+static cat_status process_capture_data(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    uint8_t chunk[CAT_CAPTURE_CHUNK_SIZE];
+    size_t  space;
+    size_t  n = 0;
+
+    /* raw bytes are taken from input only when they can be stored in capture ring */
+    space = cat_rx_ring_space(self->cmd->capture_ring);
+    if (space > self->capture_left)
+        space = self->capture_left;
+
+    if (self->feed_data != NULL)
+    {
+        /* pushed data is copied to capture ring directly */
+        n = self->feed_size - self->feed_position;
+        if (n > space)
+            n = space;
+        if (n > 0)
+        {
+            n = cat_rx_ring_write(self->cmd->capture_ring, &self->feed_data[self->feed_position], n);
+            self->feed_position += n;
+            self->last_char_ms = self->now_ms;
+        }
+    }
+    else
+    {
+        while ((n < space) && (n < sizeof(chunk)) && (read_char(self) != 0))
+            chunk[n++] = (uint8_t) self->current_char;
+        if (n > 0)
+            n = cat_rx_ring_write(self->cmd->capture_ring, chunk, n);
+    }
+
+    self->capture_left -= n;
+    if (self->capture_left > 0)
+    {
+        if (n == 0)
+        {
+            if (space == 0)
+            {
+                /* application has to drain capture ring before next bytes are taken from input */
+                self->capture_full = true;
+            }
+            else
+            {
+                self->input_starved = true;
+            }
+            return CAT_STATUS_OK;
+        }
+        return CAT_STATUS_BUSY;
+    }
+
+    start_write_loop(self);
+    return CAT_STATUS_BUSY;
+}
+
 static cat_status process_write_loop(struct cat_object* self)
 {
     assert(self != NULL);
 
+    self->data_phase_flag = false;
+
     switch (self->cmd->write(self->cmd, (uint8_t*) get_atcmd_buf(self), self->length, self->index))
     {
     case CAT_RETURN_STATE_OK:
@@ -2412,7 +4247,10 @@ static cat_status process_write_loop(struct cat_object* self)
     case CAT_RETURN_STATE_NEXT:
         break;
     case CAT_RETURN_STATE_HOLD:
-        enable_hold_state(self);
+        enable_hold_state(self, self->cmd);
+        break;
+    case CAT_RETURN_STATE_DATA_PHASE:
+        start_data_phase(self);
         break;
     case CAT_RETURN_STATE_HOLD_EXIT_OK:
     case CAT_RETURN_STATE_HOLD_EXIT_ERROR:
@@ -2430,6 +4268,8 @@ static cat_status process_run_loop(struct cat_object* self)
 {
     assert(self != NULL);
 
+    self->data_phase_flag = false;
+
     switch (self->cmd->run(self->cmd))
     {
     case CAT_RETURN_STATE_OK:
@@ -2440,11 +4280,14 @@ static cat_status process_run_loop(struct cat_object* self)
     case CAT_RETURN_STATE_NEXT:
         break;
     case CAT_RETURN_STATE_HOLD:
-        enable_hold_state(self);
+        enable_hold_state(self, self->cmd);
         break;
     case CAT_RETURN_STATE_PRINT_CMD_LIST_OK:
         start_print_cmd_list(self);
         break;
+    case CAT_RETURN_STATE_DATA_PHASE:
+        start_data_phase(self);
+        break;
     case CAT_RETURN_STATE_HOLD_EXIT_OK:
     case CAT_RETURN_STATE_HOLD_EXIT_ERROR:
     case CAT_RETURN_STATE_ERROR:
@@ -2515,7 +4358,7 @@ static cat_status process_read_loop(struct cat_object* self, cat_fsm_type fsm)
         start_processing_format_read_args(self, fsm);
         break;
     case CAT_RETURN_STATE_HOLD:
-        enable_hold_state(self);
+        enable_hold_state(self, get_command_by_fsm(self, fsm));
         break;
     case CAT_RETURN_STATE_HOLD_EXIT_OK:
         hold_exit(self, CAT_STATUS_OK);
@@ -2594,7 +4437,7 @@ static cat_status process_test_loop(struct cat_object* self, cat_fsm_type fsm)
         start_processing_format_test_args(self, fsm);
         break;
     case CAT_RETURN_STATE_HOLD:
-        enable_hold_state(self);
+        enable_hold_state(self, get_command_by_fsm(self, fsm));
         break;
     case CAT_RETURN_STATE_HOLD_EXIT_OK:
         hold_exit(self, CAT_STATUS_OK);
@@ -2657,9 +4500,34 @@ cat_status cat_hold_exit(struct cat_object* self, cat_status status)
     if ((self->mutex != NULL) && (self->mutex->unlock() != 0))
         return CAT_STATUS_ERROR_MUTEX_UNLOCK;
 
+    if (s == CAT_STATUS_OK)
+        notify(self);
+
     return s;
 }
 
+static struct cat_command const* hash_search_command(struct cat_object* self, const char* name)
+{
+    size_t                       i, slot;
+    struct cat_command const*    cmd;
+    struct cat_hash_table const* hash = &self->cmd_hash;
+
+    slot = hash_name(name, hash->seed) & (hash->size - 1);
+    for (i = 0; i < hash->size; i++)
+    {
+        if (hash->slots[slot] == 0)
+            break;
+
+        cmd = get_command_by_index(self, hash->slots[slot] - 1U);
+        if (strcmp(cmd->name, name) == 0)
+            return cmd;
+
+        slot = (slot + 1) & (hash->size - 1);
+    }
+
+    return NULL;
+}
+
 struct cat_command const* cat_search_command_by_name(struct cat_object* self, const char* name)
 {
     size_t                    i;
@@ -2668,6 +4536,9 @@ struct cat_command const* cat_search_command_by_name(struct cat_object* self, co
     assert(self != NULL);
     assert(name != NULL);
 
+    if (self->cmd_hash.slots != NULL)
+        return hash_search_command(self, name);
+
     for (i = 0; i < self->commands_num; i++)
     {
         cmd = get_command_by_index(self, i);
@@ -2678,6 +4549,28 @@ struct cat_command const* cat_search_command_by_name(struct cat_object* self, co
     return NULL;
 }
 
+static struct cat_command_group const* hash_search_command_group(struct cat_object* self, const char* name)
+{
+    size_t                          i, slot;
+    struct cat_command_group const* cmd_group;
+    struct cat_hash_table const*    hash = &self->group_hash;
+
+    slot = hash_name(name, hash->seed) & (hash->size - 1);
+    for (i = 0; i < hash->size; i++)
+    {
+        if (hash->slots[slot] == 0)
+            break;
+
+        cmd_group = self->desc->cmd_group[hash->slots[slot] - 1U];
+        if (strcmp(cmd_group->name, name) == 0)
+            return cmd_group;
+
+        slot = (slot + 1) & (hash->size - 1);
+    }
+
+    return NULL;
+}
+
 struct cat_command_group const* cat_search_command_group_by_name(struct cat_object* self, const char* name)
 {
     size_t                          i;
@@ -2686,6 +4579,9 @@ struct cat_command_group const* cat_search_command_group_by_name(struct cat_obje
     assert(self != NULL);
     assert(name != NULL);
 
+    if (self->group_hash.slots != NULL)
+        return hash_search_command_group(self, name);
+
     for (i = 0; i < self->desc->cmd_group_num; i++)
     {
         cmd_group = self->desc->cmd_group[i];
@@ -2696,16 +4592,40 @@ struct cat_command_group const* cat_search_command_group_by_name(struct cat_obje
     return NULL;
 }
 
+static struct cat_variable const* hash_search_variable(struct cat_object* self, struct cat_command const* cmd, const char* name)
+{
+    size_t                       i, slot, index;
+    struct cat_hash_table const* hash = &self->var_hash;
+
+    slot = hash_var_name(cmd, name, hash->seed) & (hash->size - 1);
+    for (i = 0; i < hash->size; i++)
+    {
+        if (hash->slots[slot] == 0)
+            break;
+
+        /* slots keep only variable index, so other commands variables are filtered by name */
+        index = hash->slots[slot] - 1U;
+        if ((index < cmd->var_num) && (cmd->var[index].name != NULL) && (strcmp(cmd->var[index].name, name) == 0))
+            return &cmd->var[index];
+
+        slot = (slot + 1) & (hash->size - 1);
+    }
+
+    return NULL;
+}
+
 struct cat_variable const* cat_search_variable_by_name(struct cat_object* self, struct cat_command const* cmd, const char* name)
 {
     size_t                     i;
     struct cat_variable const* var;
-    (void) self;
 
     assert(self != NULL);
     assert(cmd != NULL);
     assert(name != NULL);
 
+    if (self->var_hash.slots != NULL)
+        return hash_search_variable(self, cmd, name);
+
     for (i = 0; i < cmd->var_num; i++)
     {
         var = &cmd->var[i];
@@ -2716,83 +4636,371 @@ struct cat_variable const* cat_search_variable_by_name(struct cat_object* self,
     return NULL;
 }
 
+static void load_io_write(struct cat_object* self)
+{
+    self->write_position = 0;
+    self->write_data     = get_atcmd_buf(self);
+    self->write_new_line = get_new_line_chars(self);
+
+    if (self->write_raw != false)
+    {
+        self->write_buf   = self->write_data;
+        self->write_state = CAT_WRITE_STATE_AFTER;
+    }
+    else
+    {
+        self->write_buf   = self->write_new_line;
+        self->write_state = CAT_WRITE_STATE_BEFORE;
+    }
+}
+
+static bool is_background_flush_possible(struct cat_object* self)
+{
+    if ((self->desc->atcmd_buf2 == NULL) || (self->write_raw != false))
+        return false;
+
+    return ((self->write_state_after == CAT_STATE_AFTER_FLUSH_RESET) || (self->write_state_after == CAT_STATE_AFTER_FLUSH_OK)) ? true : false;
+}
+
+static bool is_line_pending(struct cat_object* self)
+{
+    switch (self->state)
+    {
+    case CAT_STATE_ERROR:
+    case CAT_STATE_PARSE_PREFIX:
+    case CAT_STATE_PARSE_COMMAND_CHAR:
+    case CAT_STATE_WAIT_READ_ACKNOWLEDGE:
+    case CAT_STATE_WAIT_TEST_ACKNOWLEDGE:
+    case CAT_STATE_PARSE_COMMAND_ARGS:
+    case CAT_STATE_DATA_PHASE:
+    case CAT_STATE_CAPTURE_DATA:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool is_output_writing(struct cat_object* self, cat_fsm_type fsm)
+{
+    switch (fsm)
+    {
+    case CAT_FSM_TYPE_ATCMD:
+        return ((self->state == CAT_STATE_FLUSH_IO_WRITE) || (self->flush_pending != false)) ? true : false;
+    case CAT_FSM_TYPE_UNSOLICITED:
+        return (self->unsolicited_fsm.state == CAT_UNSOLICITED_STATE_FLUSH_IO_WRITE) ? true : false;
+    default:
+        assert(false);
+    }
+
+    return false;
+}
+
+static bool is_output_pending(struct cat_object* self, cat_fsm_type fsm)
+{
+    switch (fsm)
+    {
+    case CAT_FSM_TYPE_ATCMD:
+        /* command is processed and response will be written without waiting for input or hold exit */
+        return ((self->state != CAT_STATE_IDLE) && (self->state != CAT_STATE_HOLD) && (is_line_pending(self) == false)) ? true : false;
+    case CAT_FSM_TYPE_UNSOLICITED:
+        return (self->unsolicited_fsm.state != CAT_UNSOLICITED_STATE_IDLE) ? true : false;
+    default:
+        assert(false);
+    }
+
+    return false;
+}
+
+static bool is_output_waiting(struct cat_object* self, cat_fsm_type fsm)
+{
+    switch (fsm)
+    {
+    case CAT_FSM_TYPE_ATCMD:
+        return (self->state == CAT_STATE_FLUSH_IO_WRITE_WAIT) ? true : false;
+    case CAT_FSM_TYPE_UNSOLICITED:
+        return (self->unsolicited_fsm.state == CAT_UNSOLICITED_STATE_FLUSH_IO_WRITE_WAIT) ? true : false;
+    default:
+        assert(false);
+    }
+
+    return false;
+}
+
+static uint8_t get_write_priority(struct cat_object* self, cat_fsm_type fsm)
+{
+    return (fsm == CAT_FSM_TYPE_ATCMD) ? self->desc->atcmd_write_priority : self->desc->unsolicited_write_priority;
+}
+
+static bool acquire_output(struct cat_object* self, cat_fsm_type fsm)
+{
+    cat_fsm_type            other = (fsm == CAT_FSM_TYPE_ATCMD) ? CAT_FSM_TYPE_UNSOLICITED : CAT_FSM_TYPE_ATCMD;
+    struct cat_write_stats* stats = &self->write_stats[fsm];
+    uint32_t                wait_steps, wait_ms;
+
+    if (is_output_writing(self, other) != false)
+        return false;
+
+    if ((get_write_priority(self, other) > get_write_priority(self, fsm)) && (is_output_pending(self, other) != false))
+        return false;
+
+    /* with equal priorities line which started waiting in earlier service step is written first */
+    if ((get_write_priority(self, other) == get_write_priority(self, fsm)) && (is_output_waiting(self, other) != false) &&
+        ((int32_t) (self->write_wait_step[fsm] - self->write_wait_step[other]) > 0))
+        return false;
+
+    wait_steps = self->steps - self->write_wait_step[fsm];
+    wait_ms    = self->now_ms - self->write_wait_ms[fsm];
+
+    stats->writes++;
+    if (wait_steps > stats->max_wait_steps)
+        stats->max_wait_steps = wait_steps;
+    if (wait_ms > stats->max_wait_ms)
+        stats->max_wait_ms = wait_ms;
+
+    return true;
+}
+
 static cat_status process_io_write_wait(struct cat_object* self)
 {
-    if (self->unsolicited_fsm.state != CAT_UNSOLICITED_STATE_FLUSH_IO_WRITE)
+    if ((self->flush_pending != false) || (acquire_output(self, CAT_FSM_TYPE_ATCMD) == false))
+        return CAT_STATUS_BUSY;
+
+    load_io_write(self);
+
+    if (is_background_flush_possible(self) == false)
+    {
         self->state = CAT_STATE_FLUSH_IO_WRITE;
+        return CAT_STATUS_BUSY;
+    }
+
+    /* final response stays in current buffer, next command is received into another one */
+    self->flush_pending   = true;
+    self->flush_ok        = (self->write_state_after == CAT_STATE_AFTER_FLUSH_OK) ? true : false;
+    self->atcmd_buf_index = (self->atcmd_buf_index != 0) ? 0 : 1;
+    reset_state(self);
 
     return CAT_STATUS_BUSY;
 }
 
 static cat_status unsolicited_process_io_write_wait(struct cat_object* self)
 {
-    if (self->state != CAT_STATE_FLUSH_IO_WRITE)
+    if (acquire_output(self, CAT_FSM_TYPE_UNSOLICITED) != false)
         self->unsolicited_fsm.state = CAT_UNSOLICITED_STATE_FLUSH_IO_WRITE;
 
     return CAT_STATUS_BUSY;
 }
 
-static cat_status process_io_write(struct cat_object* self)
+static bool is_tx_ring_enabled(struct cat_object* self)
 {
-    char ch = self->write_buf[self->position];
+    return ((self->desc->tx_ring != NULL) && (self->io->start_tx != NULL)) ? true : false;
+}
 
-    if (ch == '\0')
+static bool is_bulk_write_enabled(struct cat_object* self)
+{
+    return ((self->io->write_buf != NULL) || (is_tx_ring_enabled(self) != false)) ? true : false;
+}
+
+static size_t tx_ring_write(struct cat_object* self, const char* data, size_t len)
+{
+    size_t size  = self->desc->tx_ring_size;
+    size_t space = (self->tx_tail + size - self->tx_head - 1U) % size;
+    size_t n, chunk;
+
+    n     = (len < space) ? len : space;
+    chunk = size - self->tx_head;
+    if (chunk > n)
+        chunk = n;
+
+    memcpy(&self->desc->tx_ring[self->tx_head], data, chunk);
+    memcpy(self->desc->tx_ring, &data[chunk], n - chunk);
+
+    self->tx_head = (self->tx_head + n) % size;
+    return n;
+}
+
+static void tx_ring_kick(struct cat_object* self)
+{
+    size_t tail;
+
+    if ((is_tx_ring_enabled(self) == false) || (self->tx_len != 0))
+        return;
+
+    tail = self->tx_tail;
+    if (tail == self->tx_head)
+        return;
+
+    self->tx_len = (self->tx_head > tail) ? (self->tx_head - tail) : (self->desc->tx_ring_size - tail);
+    if (self->io->start_tx(&self->desc->tx_ring[tail], self->tx_len) != 1)
+    {
+        self->tx_len         = 0;
+        self->output_blocked = true;
+    }
+}
+
+static size_t write_output(struct cat_object* self, const char* data, size_t len)
+{
+    if (is_tx_ring_enabled(self) != false)
+        return tx_ring_write(self, data, len);
+
+    return self->io->write_buf(data, len);
+}
+
+static bool write_io_buffer(struct cat_object* self, const char* buf, size_t* position)
+{
+    size_t len = strlen(&buf[*position]);
+    size_t written;
+
+    if (len == 0)
+        return true;
+
+    written = write_output(self, &buf[*position], len);
+    assert(written <= len);
+
+    *position += written;
+    if (written < len)
+    {
+        self->output_blocked = true;
+        return false;
+    }
+
+    return true;
+}
+
+static void finish_background_flush(struct cat_object* self)
+{
+    if (self->flush_ok == false)
+    {
+        self->flush_pending = false;
+        return;
+    }
+
+    self->flush_ok       = false;
+    self->write_position = 0;
+    self->write_buf      = self->write_new_line;
+    self->write_data     = "OK";
+    self->write_state    = CAT_WRITE_STATE_BEFORE;
+}
+
+static void switch_io_write_state(struct cat_object* self)
+{
+    switch (self->write_state)
     {
-        switch (self->write_state)
+    case CAT_WRITE_STATE_BEFORE:
+        self->write_position = 0;
+        self->write_buf      = self->write_data;
+        self->write_state    = CAT_WRITE_STATE_MAIN_BUFFER;
+        break;
+    case CAT_WRITE_STATE_MAIN_BUFFER:
+        self->write_position = 0;
+        self->write_buf      = self->write_new_line;
+        self->write_state    = CAT_WRITE_STATE_AFTER;
+        break;
+    case CAT_WRITE_STATE_AFTER:
+        if (self->flush_pending != false)
         {
-        case CAT_WRITE_STATE_BEFORE:
-            self->position    = 0;
-            self->write_buf   = get_atcmd_buf(self);
-            self->write_state = CAT_WRITE_STATE_MAIN_BUFFER;
-            break;
-        case CAT_WRITE_STATE_MAIN_BUFFER:
-            self->position    = 0;
-            self->write_buf   = get_new_line_chars(self);
-            self->write_state = CAT_WRITE_STATE_AFTER;
+            finish_background_flush(self);
             break;
-        case CAT_WRITE_STATE_AFTER:
-            self->state = self->write_state_after;
-            break;
-        default:
+        }
+        self->state = self->write_state_after;
+        break;
+    default:
+        break;
+    }
+}
+
+static cat_status process_io_write_buf(struct cat_object* self)
+{
+    while (write_io_buffer(self, self->write_buf, &self->write_position) != false)
+    {
+        if (self->write_state == CAT_WRITE_STATE_AFTER)
+        {
+            switch_io_write_state(self);
             break;
         }
+        switch_io_write_state(self);
+    }
+
+    return CAT_STATUS_BUSY;
+}
+
+static cat_status process_io_write(struct cat_object* self)
+{
+    if (is_bulk_write_enabled(self) != false)
+        return process_io_write_buf(self);
+
+    char ch = self->write_buf[self->write_position];
+
+    if (ch == '\0')
+    {
+        switch_io_write_state(self);
         return CAT_STATUS_BUSY;
     }
 
     if (self->io->write(ch) != 1)
+    {
+        self->output_blocked = true;
         return CAT_STATUS_BUSY;
+    }
 
-    self->position++;
+    self->write_position++;
     return CAT_STATUS_BUSY;
 }
 
-static cat_status unsolicited_process_io_write(struct cat_object* self)
+static void unsolicited_switch_io_write_state(struct cat_object* self)
 {
-    char ch = self->unsolicited_fsm.write_buf[self->unsolicited_fsm.position];
+    switch (self->unsolicited_fsm.write_state)
+    {
+    case CAT_WRITE_STATE_BEFORE:
+        self->unsolicited_fsm.position    = 0;
+        self->unsolicited_fsm.write_buf   = get_unsolicited_buf(self);
+        self->unsolicited_fsm.write_state = CAT_WRITE_STATE_MAIN_BUFFER;
+        break;
+    case CAT_WRITE_STATE_MAIN_BUFFER:
+        self->unsolicited_fsm.position    = 0;
+        self->unsolicited_fsm.write_buf   = get_new_line_chars(self);
+        self->unsolicited_fsm.write_state = CAT_WRITE_STATE_AFTER;
+        break;
+    case CAT_WRITE_STATE_AFTER:
+        self->unsolicited_fsm.state = self->unsolicited_fsm.write_state_after;
+        break;
+    default:
+        break;
+    }
+}
 
-    if (ch == '\0')
+static cat_status unsolicited_process_io_write_buf(struct cat_object* self)
+{
+    while (write_io_buffer(self, self->unsolicited_fsm.write_buf, &self->unsolicited_fsm.position) != false)
     {
-        switch (self->unsolicited_fsm.write_state)
+        if (self->unsolicited_fsm.write_state == CAT_WRITE_STATE_AFTER)
         {
-        case CAT_WRITE_STATE_BEFORE:
-            self->unsolicited_fsm.position    = 0;
-            self->unsolicited_fsm.write_buf   = get_unsolicited_buf(self);
-            self->unsolicited_fsm.write_state = CAT_WRITE_STATE_MAIN_BUFFER;
-            break;
-        case CAT_WRITE_STATE_MAIN_BUFFER:
-            self->unsolicited_fsm.position    = 0;
-            self->unsolicited_fsm.write_buf   = get_new_line_chars(self);
-            self->unsolicited_fsm.write_state = CAT_WRITE_STATE_AFTER;
-            break;
-        case CAT_WRITE_STATE_AFTER:
-            self->unsolicited_fsm.state = self->unsolicited_fsm.write_state_after;
+            unsolicited_switch_io_write_state(self);
             break;
         }
+        unsolicited_switch_io_write_state(self);
+    }
+
+    return CAT_STATUS_BUSY;
+}
+
+static cat_status unsolicited_process_io_write(struct cat_object* self)
+{
+    if (is_bulk_write_enabled(self) != false)
+        return unsolicited_process_io_write_buf(self);
+
+    char ch = self->unsolicited_fsm.write_buf[self->unsolicited_fsm.position];
+
+    if (ch == '\0')
+    {
+        unsolicited_switch_io_write_state(self);
         return CAT_STATUS_BUSY;
     }
 
     if (self->io->write(ch) != 1)
+    {
+        self->output_blocked = true;
         return CAT_STATUS_BUSY;
+    }
 
     self->unsolicited_fsm.position++;
     return CAT_STATUS_BUSY;
@@ -2842,29 +5050,96 @@ static cat_status unsolicited_events_service(struct cat_object* self)
         s = CAT_STATUS_BUSY;
         break;
     default:
-        break;
+        break;
+    }
+
+    return s;
+}
+
+static bool is_unsolicited_fsm_busy(struct cat_object* self)
+{
+    return (self->unsolicited_fsm.state != CAT_UNSOLICITED_STATE_IDLE);
+}
+
+static bool is_receiving_line(struct cat_object* self)
+{
+    switch (self->state)
+    {
+    case CAT_STATE_IDLE:
+    case CAT_STATE_ERROR:
+    case CAT_STATE_PARSE_PREFIX:
+    case CAT_STATE_PARSE_COMMAND_CHAR:
+    case CAT_STATE_UPDATE_COMMAND_STATE:
+    case CAT_STATE_SEARCH_COMMAND:
+    case CAT_STATE_PARSE_COMMAND_ARGS:
+        return true;
+    case CAT_STATE_COMMAND_FOUND:
+        return (self->cmd_type == CAT_CMD_TYPE_WRITE) ? true : false;
+    default:
+        return false;
     }
+}
 
-    return s;
+static bool is_hold_pending(struct cat_object* self)
+{
+    return ((self->state == CAT_STATE_HOLD) && (self->hold_exit_status == 0)) ? true : false;
 }
 
-static bool is_unsolicited_fsm_busy(struct cat_object* self)
+static cat_stop_reason get_stop_reason(struct cat_object* self, cat_status s)
 {
-    return (self->unsolicited_fsm.state != CAT_UNSOLICITED_STATE_IDLE);
+    if (self->output_blocked != false)
+        return CAT_STOP_REASON_OUTPUT_BLOCKED;
+
+    if ((is_unsolicited_fsm_busy(self) != false) || (self->flush_pending != false))
+        return CAT_STOP_REASON_NONE;
+
+    if (is_hold_pending(self) != false)
+        return CAT_STOP_REASON_HOLD;
+
+    if (self->capture_full != false)
+        return CAT_STOP_REASON_CAPTURE_FULL;
+
+    if (self->input_starved != false)
+        return (self->state == CAT_STATE_IDLE) ? CAT_STOP_REASON_IDLE : CAT_STOP_REASON_NEED_INPUT;
+
+    return (s == CAT_STATUS_BUSY) ? CAT_STOP_REASON_NONE : CAT_STOP_REASON_IDLE;
 }
 
-cat_status cat_service(struct cat_object* self)
+static cat_status finish_service_step(struct cat_object* self, cat_status s, cat_status unsolicited_stat)
+{
+    tx_ring_kick(self);
+
+    if ((unsolicited_stat != CAT_STATUS_OK) || (is_unsolicited_fsm_busy(self) != false) || (self->flush_pending != false))
+    {
+        s = CAT_STATUS_BUSY;
+    }
+
+    self->wait_reason = get_stop_reason(self, s);
+
+    return s;
+}
+
+static cat_status service_step(struct cat_object* self)
 {
     cat_status s;
     cat_status unsolicited_stat;
 
-    assert(self != NULL);
-
-    if ((self->mutex != NULL) && (self->mutex->lock() != 0))
-        return CAT_STATUS_ERROR_MUTEX_LOCK;
+    self->input_starved  = false;
+    self->output_blocked = false;
+    self->capture_full   = false;
+    self->steps++;
 
     unsolicited_stat = unsolicited_events_service(self);
 
+    if (self->flush_pending != false)
+    {
+        (void) process_io_write(self);
+
+        /* next command is only received until previous response is flushed */
+        if (is_receiving_line(self) == false)
+            return finish_service_step(self, CAT_STATUS_BUSY, unsolicited_stat);
+    }
+
     switch (self->state)
     {
     case CAT_STATE_ERROR:
@@ -2950,22 +5225,221 @@ cat_status cat_service(struct cat_object* self)
         print_cmd_list(self);
         s = CAT_STATUS_BUSY;
         break;
+    case CAT_STATE_DATA_PHASE:
+        s = process_data_phase(self);
+        break;
+    case CAT_STATE_CAPTURE_DATA:
+        s = process_capture_data(self);
+        break;
     default:
         s = CAT_STATUS_ERROR_UNKNOWN_STATE;
         break;
     }
 
-    if ((unsolicited_stat != CAT_STATUS_OK) || (is_unsolicited_fsm_busy(self) != false))
+    return finish_service_step(self, s, unsolicited_stat);
+}
+
+cat_status cat_service(struct cat_object* self)
+{
+    cat_status s;
+
+    assert(self != NULL);
+
+    if ((self->mutex != NULL) && (self->mutex->lock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_LOCK;
+
+    s = service_step(self);
+
+    if ((self->mutex != NULL) && (self->mutex->unlock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_UNLOCK;
+
+    return s;
+}
+
+/* runs state machines steps under already locked mutex until stop reason is reported or budget is exhausted */
+static cat_status run_service_steps(struct cat_object* self, size_t max_steps, cat_stop_reason* reason)
+{
+    cat_status      s    = CAT_STATUS_OK;
+    cat_stop_reason stop = CAT_STOP_REASON_BUDGET;
+
+    while (max_steps > 0)
     {
-        s = CAT_STATUS_BUSY;
+        s = service_step(self);
+        max_steps--;
+
+        stop = self->wait_reason;
+        if (stop != CAT_STOP_REASON_NONE)
+            break;
+
+        stop = CAT_STOP_REASON_BUDGET;
     }
 
+    if (reason != NULL)
+        *reason = stop;
+
+    return s;
+}
+
+cat_status cat_service_run(struct cat_object* self, size_t max_steps, cat_stop_reason* reason)
+{
+    cat_status s;
+
+    assert(self != NULL);
+
+    if ((self->mutex != NULL) && (self->mutex->lock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_LOCK;
+
+    s = run_service_steps(self, max_steps, reason);
+
+    if ((self->mutex != NULL) && (self->mutex->unlock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_UNLOCK;
+
+    return s;
+}
+
+cat_status cat_feed(struct cat_object* self, const uint8_t* data, size_t len, size_t* consumed, size_t max_steps, cat_stop_reason* reason)
+{
+    cat_status s;
+
+    assert(self != NULL);
+    assert((data != NULL) || (len == 0));
+    assert(consumed != NULL);
+
+    *consumed = 0;
+
+    if ((self->mutex != NULL) && (self->mutex->lock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_LOCK;
+
+    self->feed_data     = data;
+    self->feed_size     = len;
+    self->feed_position = 0;
+
+    s = run_service_steps(self, max_steps, reason);
+
+    *consumed           = self->feed_position;
+    self->feed_data     = NULL;
+    self->feed_size     = 0;
+    self->feed_position = 0;
+
     if ((self->mutex != NULL) && (self->mutex->unlock() != 0))
         return CAT_STATUS_ERROR_MUTEX_UNLOCK;
 
     return s;
 }
 
+static bool check_timeouts(struct cat_object* self)
+{
+    if ((self->hold_state_flag != false) && (self->hold_exit_status == 0) && (self->hold_timeout_ms != 0) &&
+        ((uint32_t) (self->now_ms - self->hold_start_ms) >= self->hold_timeout_ms))
+    {
+        (void) hold_exit(self, CAT_STATUS_ERROR);
+        return true;
+    }
+
+    if ((self->desc->char_timeout_ms != 0) && (is_line_pending(self) != false) &&
+        ((uint32_t) (self->now_ms - self->last_char_ms) >= self->desc->char_timeout_ms))
+    {
+        ack_error(self);
+        return true;
+    }
+
+    return false;
+}
+
+cat_status cat_tick(struct cat_object* self, uint32_t now_ms)
+{
+    bool expired;
+
+    assert(self != NULL);
+
+    if ((self->mutex != NULL) && (self->mutex->lock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_LOCK;
+
+    self->now_ms = now_ms;
+    expired      = check_timeouts(self);
+
+    if ((self->mutex != NULL) && (self->mutex->unlock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_UNLOCK;
+
+    if (expired != false)
+        notify(self);
+
+    return CAT_STATUS_OK;
+}
+
+cat_status cat_get_write_stats(struct cat_object* self, cat_fsm_type fsm, struct cat_write_stats* stats)
+{
+    assert(self != NULL);
+    assert(fsm < CAT_FSM_TYPE__TOTAL_NUM);
+    assert(stats != NULL);
+
+    if ((self->mutex != NULL) && (self->mutex->lock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_LOCK;
+
+    *stats = self->write_stats[fsm];
+
+    if ((self->mutex != NULL) && (self->mutex->unlock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_UNLOCK;
+
+    return CAT_STATUS_OK;
+}
+
+cat_status cat_reset_write_stats(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    if ((self->mutex != NULL) && (self->mutex->lock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_LOCK;
+
+    memset(self->write_stats, 0, sizeof(self->write_stats));
+
+    if ((self->mutex != NULL) && (self->mutex->unlock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_UNLOCK;
+
+    return CAT_STATUS_OK;
+}
+
+cat_status cat_get_wait_reason(struct cat_object* self, cat_stop_reason* reason)
+{
+    assert(self != NULL);
+    assert(reason != NULL);
+
+    if ((self->mutex != NULL) && (self->mutex->lock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_LOCK;
+
+    *reason = self->wait_reason;
+
+    if ((self->mutex != NULL) && (self->mutex->unlock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_UNLOCK;
+
+    return CAT_STATUS_OK;
+}
+
+void cat_tx_complete(struct cat_object* self, size_t n)
+{
+    assert(self != NULL);
+    assert(n <= self->tx_len);
+
+    self->tx_tail = (self->tx_tail + n) % self->desc->tx_ring_size;
+    self->tx_len  = 0;
+
+    notify(self);
+}
+
+void cat_input_available(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    notify(self);
+}
+
+void cat_output_ready(struct cat_object* self)
+{
+    assert(self != NULL);
+
+    notify(self);
+}
+
 cat_status cat_set_prompt_handler(struct cat_object* self, cat_prompt_detected_handler handler)
 {
     assert(self != NULL);
@@ -2981,4 +5455,177 @@ cat_status cat_set_prompt_handler(struct cat_object* self, cat_prompt_detected_h
     return CAT_STATUS_OK;
 }
 
+cat_return_state cat_start_data_phase(struct cat_object* self, const struct cat_data_phase* phase)
+{
+    assert(self != NULL);
+    assert(phase != NULL);
+
+    if ((self->state != CAT_STATE_WRITE_LOOP) && (self->state != CAT_STATE_RUN_LOOP))
+        return CAT_RETURN_STATE_ERROR;
+
+    if ((phase->buf == NULL) || (phase->buf_size == 0))
+        return CAT_RETURN_STATE_ERROR;
+
+    if ((phase->handler == NULL) && (phase->buf_size < phase->size))
+        return CAT_RETURN_STATE_ERROR;
+
+    self->data_phase      = *phase;
+    self->data_position   = 0;
+    self->data_fill       = 0;
+    self->data_error      = false;
+    self->data_phase_flag = true;
+
+    return CAT_RETURN_STATE_DATA_PHASE;
+}
+
+cat_status cat_set_notify_handler(struct cat_object* self, cat_notify_handler handler)
+{
+    assert(self != NULL);
+
+    if ((self->mutex != NULL) && (self->mutex->lock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_LOCK;
+
+    self->notify_handler = handler;
+
+    if ((self->mutex != NULL) && (self->mutex->unlock() != 0))
+        return CAT_STATUS_ERROR_MUTEX_UNLOCK;
+
+    return CAT_STATUS_OK;
+}
+
+#ifdef CAT_RX_RING_ATOMICS
+#define RX_RING_LOAD(x) atomic_load_explicit(&(x), memory_order_acquire)
+#define RX_RING_STORE(x, v) atomic_store_explicit(&(x), (v), memory_order_release)
+#else
+/* barrier after load and before store gives acquire and release ordering of ring storage accesses */
+static inline size_t rx_ring_load(cat_rx_ring_index* index)
+{
+    size_t val = *index;
+    CAT_RX_RING_BARRIER();
+    return val;
+}
+
+static inline void rx_ring_store(cat_rx_ring_index* index, size_t val)
+{
+    CAT_RX_RING_BARRIER();
+    *index = val;
+}
+
+#define RX_RING_LOAD(x) rx_ring_load(&(x))
+#define RX_RING_STORE(x, v) rx_ring_store(&(x), (v))
+#endif
+
+void cat_rx_ring_init(struct cat_rx_ring* ring, uint8_t* buf, size_t size)
+{
+    assert(ring != NULL);
+    assert(buf != NULL);
+    assert(size >= 2U);
+
+    ring->buf  = buf;
+    ring->size = size;
+
+    RX_RING_STORE(ring->head, 0);
+    RX_RING_STORE(ring->tail, 0);
+    RX_RING_STORE(ring->received, 0);
+    RX_RING_STORE(ring->overruns, 0);
+}
+
+size_t cat_rx_ring_write(struct cat_rx_ring* ring, const uint8_t* data, size_t len)
+{
+    size_t head, space, n, chunk;
+
+    assert(ring != NULL);
+    assert((data != NULL) || (len == 0));
+
+    head  = RX_RING_LOAD(ring->head);
+    space = (RX_RING_LOAD(ring->tail) + ring->size - head - 1U) % ring->size;
+    n     = (len < space) ? len : space;
+    chunk = ring->size - head;
+    if (chunk > n)
+        chunk = n;
+
+    if (n > 0)
+    {
+        memcpy(&ring->buf[head], data, chunk);
+        memcpy(ring->buf, &data[chunk], n - chunk);
+
+        RX_RING_STORE(ring->head, (head + n) % ring->size);
+        RX_RING_STORE(ring->received, RX_RING_LOAD(ring->received) + n);
+    }
+    if (n < len)
+        RX_RING_STORE(ring->overruns, RX_RING_LOAD(ring->overruns) + (len - n));
+
+    return n;
+}
+
+size_t cat_rx_ring_read(struct cat_rx_ring* ring, uint8_t* data, size_t len)
+{
+    size_t tail, available, n, chunk;
+
+    assert(ring != NULL);
+    assert((data != NULL) || (len == 0));
+
+    tail      = RX_RING_LOAD(ring->tail);
+    available = (RX_RING_LOAD(ring->head) + ring->size - tail) % ring->size;
+    n         = (len < available) ? len : available;
+    chunk     = ring->size - tail;
+    if (chunk > n)
+        chunk = n;
+
+    if (n == 0)
+        return 0;
+
+    memcpy(data, &ring->buf[tail], chunk);
+    memcpy(&data[chunk], ring->buf, n - chunk);
+
+    RX_RING_STORE(ring->tail, (tail + n) % ring->size);
+
+    return n;
+}
+
+int cat_rx_ring_read_char(struct cat_rx_ring* ring, char* ch)
+{
+    size_t tail;
+
+    assert(ring != NULL);
+    assert(ch != NULL);
+
+    tail = RX_RING_LOAD(ring->tail);
+    if (tail == RX_RING_LOAD(ring->head))
+        return 0;
+
+    *ch = (char) ring->buf[tail];
+    RX_RING_STORE(ring->tail, (tail + 1U == ring->size) ? 0 : tail + 1U);
+
+    return 1;
+}
+
+size_t cat_rx_ring_available(struct cat_rx_ring* ring)
+{
+    assert(ring != NULL);
+
+    return (RX_RING_LOAD(ring->head) + ring->size - RX_RING_LOAD(ring->tail)) % ring->size;
+}
+
+size_t cat_rx_ring_space(struct cat_rx_ring* ring)
+{
+    assert(ring != NULL);
+
+    return (RX_RING_LOAD(ring->tail) + ring->size - RX_RING_LOAD(ring->head) - 1U) % ring->size;
+}
+
+size_t cat_rx_ring_overruns(struct cat_rx_ring* ring)
+{
+    assert(ring != NULL);
+
+    return RX_RING_LOAD(ring->overruns);
+}
+
+size_t cat_rx_ring_received(struct cat_rx_ring* ring)
+{
+    assert(ring != NULL);
+
+    return RX_RING_LOAD(ring->received);
+}
+
 // NOLINTEND
@@ -39,12 +39,44 @@ extern "C"
 /* only forward declarations (looks for definition below) */
 struct cat_command;
 struct cat_variable;
+struct cat_enum;
+struct cat_rx_ring;
 
 #ifndef CAT_UNSOLICITED_CMD_BUFFER_SIZE
 /* unsolicited command buffer default size (can by override externally during compilation) */
 #define CAT_UNSOLICITED_CMD_BUFFER_SIZE ((size_t) (1))
 #endif
 
+#ifndef CAT_CAPTURE_CHUNK_SIZE
+/* number of captured raw bytes pulled by io read function and copied to capture ring at once (can by override externally during compilation) */
+#define CAT_CAPTURE_CHUNK_SIZE ((size_t) (16))
+#endif
+
+#ifndef CAT_RX_RING_BARRIER
+/*
+ * barrier ordering rx ring storage accesses against index accesses when library is built without CAT_RX_RING_ATOMICS
+ * (default compiler barrier is enough for isr producer on single core, can by override externally during compilation,
+ * e.g. with __DMB() or __sync_synchronize() when producer and consumer run on different cores)
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define CAT_RX_RING_BARRIER() __asm__ volatile("" ::: "memory")
+#else
+#define CAT_RX_RING_BARRIER() ((void) 0)
+#endif
+#endif
+
+#if defined(CAT_RX_RING_ATOMICS) && !defined(__cplusplus)
+#include <stdatomic.h>
+/* type of rx ring indexes and counters (C11 atomic object when library is built with CAT_RX_RING_ATOMICS) */
+typedef atomic_size_t cat_rx_ring_index;
+#else
+/* type of rx ring indexes and counters (has the same representation as atomic_size_t) */
+typedef size_t volatile cat_rx_ring_index;
+#endif
+
+/* maximum number of fraction digits of fixed point variables (scaled value has to fit into 64 bits) */
+#define CAT_FIXED_DEC_MAX_SCALE (18U)
+
 /* enum type with variable type definitions */
 typedef enum
 {
@@ -52,7 +84,12 @@ typedef enum
     CAT_VAR_UINT_DEC,    /* decimal encoded unsigned integer variable */
     CAT_VAR_NUM_HEX,     /* hexadecimal encoded unsigned integer variable */
     CAT_VAR_BUF_HEX,     /* asciihex encoded bytes array */
-    CAT_VAR_BUF_STRING   /* string variable */
+    CAT_VAR_BUF_STRING,  /* string variable */
+    CAT_VAR_BUF_BASE64,  /* base64 encoded bytes array */
+    CAT_VAR_BUF_VIEW,    /* string variable passed as slice of parsed arguments (data points to struct cat_buf_view) */
+    CAT_VAR_SKIP,        /* placeholder for data_size (at least one) fields passed over without storage and validation */
+    CAT_VAR_ENUM,        /* keyword from variable keywords table, stored as unsigned integer index */
+    CAT_VAR_FIXED_DEC    /* decimal fraction stored as signed integer scaled by 10 to the power of variable scale */
 } cat_var_type;
 
 /* enum type with variable accessors definitions */
@@ -103,16 +140,47 @@ typedef int (*cat_var_write_handler)(const struct cat_variable* var, const size_
  * */
 typedef int (*cat_var_read_handler)(const struct cat_variable* var);
 
+/**
+ * Chunk variable function handler
+ *
+ * This callback function is called when parsed buffer variable (hex buffer or string) fills variable data,
+ * and once more with rest of data when parsing of variable value is finished.
+ * Variable data can be used as small staging buffer this way, while value length is not limited by data size.
+ * This handler is optional, so when is not defined, value has to fit variable data.
+ *
+ * @param var - pointer to struct descriptor of parsed variable
+ * @param offset - offset of passed chunk in whole variable value
+ * @param size - size of chunk stored in variable data
+ * @return 0 - ok, else error and stop parsing
+ * */
+typedef int (*cat_var_chunk_handler)(const struct cat_variable* var, const size_t offset, const size_t size);
+
+/*
+ * structure with CAT_VAR_BUF_VIEW variable value
+ * After write, it points into parser working buffer (not null terminated, quotes stripped, escape sequences not decoded),
+ * so it is valid only inside variable write handler and command write handler (not in stream_args mode).
+ * Before read, application can point it to any text, which is printed as string.
+ */
+struct cat_buf_view
+{
+    const char* data; /* pointer to first char of value */
+    size_t      size; /* number of chars */
+};
+
 struct cat_variable
 {
     const char*    name;      /* variable name (optional - using only for auto format test command response) */
     cat_var_type   type;      /* variable type (needed for parsing and validating) */
     void*          data;      /* generic pointer to statically allocated memory for variable data read/write/validate operations */
-    size_t         data_size; /* variable data size, pointed by data pointer */
+    size_t         data_size; /* variable data size, pointed by data pointer (1, 2, 4 or 8 bytes for numeric types) */
     cat_var_access access;    /* variable accessor */
 
     cat_var_write_handler write; /* write variable handler */
     cat_var_read_handler  read;  /* read variable handler */
+    cat_var_chunk_handler chunk; /* chunk variable handler (optional, only for buffer variables) */
+
+    struct cat_enum const* keywords; /* keywords table (only for enum variables) */
+    uint8_t                scale;    /* number of fraction digits (only for fixed point variables, up to CAT_FIXED_DEC_MAX_SCALE) */
 };
 
 /* enum type with command callbacks return values meaning */
@@ -127,8 +195,21 @@ typedef enum
     CAT_RETURN_STATE_HOLD_EXIT_OK,      /* exit from hold state with OK response */
     CAT_RETURN_STATE_HOLD_EXIT_ERROR,   /* exit from hold state with ERROR response */
     CAT_RETURN_STATE_PRINT_CMD_LIST_OK, /* print commands list followed by ok acknowledge (only in TEST and RUN) */
+    CAT_RETURN_STATE_DATA_PHASE,        /* print prompt and receive raw data requested by cat_start_data_phase (only in WRITE and RUN) */
 } cat_return_state;
 
+/* enum type with reasons of stopping state machines processing */
+typedef enum
+{
+    CAT_STOP_REASON_NONE = 0,       /* state machines can make further progress */
+    CAT_STOP_REASON_IDLE,           /* nothing to do, parser waits for new command */
+    CAT_STOP_REASON_NEED_INPUT,     /* input data exhausted in the middle of command processing */
+    CAT_STOP_REASON_OUTPUT_BLOCKED, /* output stream cannot accept next char */
+    CAT_STOP_REASON_HOLD,           /* command handler enabled hold state */
+    CAT_STOP_REASON_CAPTURE_FULL,   /* command capture ring is full, application has to read captured bytes */
+    CAT_STOP_REASON_BUDGET          /* steps budget exhausted */
+} cat_stop_reason;
+
 /**
  * Write command function handler (AT+CMD=)
  *
@@ -192,6 +273,20 @@ typedef cat_return_state (*cat_cmd_run_handler)(const struct cat_command* cmd);
  * */
 typedef cat_return_state (*cat_cmd_test_handler)(const struct cat_command* cmd, uint8_t* data, size_t* data_size, const size_t max_data_size);
 
+/**
+ * Repeated element function handler
+ *
+ * This callback function is called each time all variables of repeated element are parsed
+ * (during write arguments parsing, before write command handler, also in stream_args mode as element arrives).
+ * Element values are available in repeated element variables until next element is parsed.
+ * This handler is optional.
+ *
+ * @param cmd - pointer to struct descriptor of processed command
+ * @param index - index of parsed element (counted from 0)
+ * @return 0 - ok, else error and stop parsing
+ * */
+typedef int (*cat_cmd_element_handler)(const struct cat_command* cmd, const size_t index);
+
 /* enum type with main at parser fsm state */
 typedef enum
 {
@@ -221,6 +316,8 @@ typedef enum
     CAT_STATE_AFTER_FLUSH_FORMAT_READ_ARGS,
     CAT_STATE_AFTER_FLUSH_FORMAT_TEST_ARGS,
     CAT_STATE_PRINT_CMD,
+    CAT_STATE_DATA_PHASE,
+    CAT_STATE_CAPTURE_DATA,
 } cat_state;
 
 /* enum type with type of command request */
@@ -238,7 +335,9 @@ typedef enum
 struct cat_io_interface
 {
     int (*write)(char ch); /* write char to output stream. return 1 if byte wrote successfully. */
-    int (*read)(char* ch); /* read char from input stream. return 1 if byte read successfully. */
+    int (*read)(char* ch); /* read char from input stream. return 1 if byte read successfully. (optionally - can be null when input is pushed by cat_feed) */
+    size_t (*write_buf)(const char* data, size_t len); /* write bytes to output stream. return number of bytes wrote (less than len if output is full). (optionally - can be null, then write is used) */
+    int (*start_tx)(const uint8_t* data, size_t len); /* start asynchronous transmission of bytes (e.g. by dma), cat_tx_complete must be called when finished. return 1 if started successfully. (optionally - can be null, used with descriptor tx_ring) */
 };
 
 /* structure with mutex interface functions */
@@ -260,6 +359,40 @@ struct cat_mutex_interface
  */
 typedef int (*cat_prompt_detected_handler)(char prompt_char);
 
+/**
+ * Raw data phase handler
+ *
+ * This callback function is called with spans of raw data received in data phase.
+ * Data pushed by cat_feed is passed directly from pushed buffer, data pulled by io read function
+ * is passed from data phase buffer each time it is filled (and with rest of data at the end).
+ *
+ * @param data pointer to received raw data span
+ * @param size size of raw data span
+ * @param offset offset of raw data span in whole data phase
+ * @return 0 - ok, else error (rest of raw data is dropped and data phase ends with ERROR acknowledge)
+ */
+typedef int (*cat_data_handler)(const uint8_t* data, const size_t size, const size_t offset);
+
+/* structure with raw data phase request */
+struct cat_data_phase
+{
+    uint8_t*         buf;      /* buffer for raw data (staging buffer when handler is set, otherwise destination of whole data) */
+    size_t           buf_size; /* size of buffer */
+    size_t           size;     /* number of raw data bytes expected after prompt */
+    cat_data_handler handler;  /* raw data spans handler (optional when whole data fits buffer) */
+};
+
+/**
+ * Notify callback handler
+ *
+ * This callback is called when at command parser has new work to do
+ * (input data available, hold state exit requested or unsolicited event triggered).
+ * It can be used to wake up service task blocked on semaphore or event.
+ * It can be called from interrupt context (when cat_input_available is called from isr),
+ * so it should only signal service task.
+ */
+typedef void (*cat_notify_handler)(void);
+
 /* structure with at command descriptor */
 struct cat_command
 {
@@ -278,6 +411,28 @@ struct cat_command
     bool only_test;      /* flag to disable read/write/run commands (only test auto description) */
     bool disable;        /* flag to completely disable command */
     bool implicit_write; /* flag to mark command as implicit write */
+    bool stream_args;    /* flag to parse write arguments on the fly (arguments line is not buffered and not passed to write handler) */
+
+    const char* test_args; /* precomputed automatic test response arguments (optionally - can be null, e.g. generated by catgen) */
+
+    uint32_t hold_timeout_ms; /* hold state timeout in ms, measured by cat_tick (0 - descriptor default is used) */
+
+    struct cat_rx_ring* capture_ring; /* ring receiving raw bytes following write command line (optional) */
+    size_t              capture_var;  /* index of writable unsigned variable with number of raw bytes to capture (used with capture_ring) */
+
+    struct cat_variable const* repeat_var;     /* pointer to array of element variables repeated after var array (optional) */
+    size_t                     repeat_var_num; /* number of variables in repeated element */
+    cat_cmd_element_handler    element;        /* repeated element handler (optional) */
+};
+
+/* structure with command names trie node (used by optional fast command names matcher) */
+struct cat_trie_node
+{
+    uint16_t child;   /* index of first child node (0 - no child) */
+    uint16_t sibling; /* index of next sibling node (0 - no sibling) */
+    uint16_t begin;   /* index of first command with this name prefix in sorted commands order */
+    uint16_t end;     /* index after last command with this name prefix in sorted commands order */
+    char     ch;      /* upper case name character leading to this node */
 };
 
 struct cat_command_group
@@ -290,6 +445,30 @@ struct cat_command_group
     bool disable; /* flag to completely disable all commands in group */
 };
 
+/* structure with names hash table (open addressing with linear probing) */
+/* slot of name is computed as 32-bit FNV-1a hash (offset basis xored with seed) masked by size - 1 */
+struct cat_hash_table
+{
+    uint16_t const* slots; /* pointer to slots with item index plus one (0 - empty slot) */
+    size_t          size;  /* number of slots (power of two) */
+    uint32_t        seed;  /* hash function seed */
+};
+
+/* structure with keywords table of enum variable */
+struct cat_enum
+{
+    const char* const*    names; /* keywords, index of matched keyword is stored in variable data */
+    size_t                num;   /* number of keywords */
+    struct cat_hash_table hash;  /* optional keywords hash table (see cat_enum_hash_init), if not configured keywords are searched linearly */
+};
+
+/* structure with flattened commands index item (used by optional commands index) */
+struct cat_command_index
+{
+    struct cat_command const* cmd;   /* pointer to command descriptor */
+    uint16_t                  group; /* index of command group in descriptor */
+};
+
 /* structure with at command parser descriptor */
 struct cat_descriptor
 {
@@ -303,6 +482,65 @@ struct cat_descriptor
     /* then the buf will be divided into two smaller buffers */
     uint8_t* unsolicited_buf;      /* pointer to unsolicited working buffer (used to parse command argument) */
     size_t   unsolicited_buf_size; /* unsolicited working buffer length */
+
+    /* optional second atcmd working buffer, if not configured (NULL) */
+    /* then next command is received only after previous response is flushed */
+    /* if configured, final response is flushed from one buffer while next command is received and matched in another one */
+    /* (command is dispatched after flush completes), both buffers are used alternately */
+    uint8_t* atcmd_buf2;      /* pointer to second atcmd working buffer */
+    size_t   atcmd_buf2_size; /* second atcmd working buffer length */
+
+    /* optional output arbiter priorities, output is granted per line (single flush) */
+    /* when priorities differ, state machine with lower priority does not start new line */
+    /* while state machine with higher priority has output to write (e.g. unsolicited event is being formatted) */
+    /* with equal priorities (default) line which started waiting in earlier service step is written first */
+    /* (unsolicited event is written first when both lines started waiting in the same service step) */
+    uint8_t atcmd_write_priority;       /* at command responses output priority */
+    uint8_t unsolicited_write_priority; /* unsolicited events output priority */
+
+    /* optional transmit ring buffer, used only when io interface has start_tx function */
+    /* responses are queued in ring (state machines do not wait for transmission) */
+    /* and transmitted asynchronously by contiguous spans passed to start_tx */
+    uint8_t* tx_ring;      /* pointer to transmit ring storage */
+    size_t   tx_ring_size; /* transmit ring storage length (one byte is always left free) */
+
+    /* optional command names trie, if not configured (NULL) */
+    /* then command names are matched by scanning all commands for every char */
+    /* trie_size must be at least total length of all command names plus one */
+    /* trie storage is filled by cat_init, read-only prebuilt trie is passed by prebuilt_trie fields (with tables_prebuilt flag) */
+    struct cat_trie_node* trie;       /* pointer to trie nodes storage */
+    size_t                trie_size;  /* trie nodes storage length (number of nodes of prebuilt trie) */
+    uint16_t*             trie_order; /* pointer to sorted commands order storage (one item per command) */
+
+    struct cat_trie_node const* prebuilt_trie;       /* pointer to prebuilt trie nodes (used instead of trie) */
+    uint16_t const*             prebuilt_trie_order; /* pointer to prebuilt sorted commands order (used instead of trie_order) */
+
+    /* optional flattened commands index, if not configured (NULL) */
+    /* then commands are located by walking through command groups */
+    /* group disable flags are read through stored group index, so they can be changed at any time */
+    /* index storage is filled by cat_init, read-only prebuilt index is passed by prebuilt_cmd_index (with tables_prebuilt flag) */
+    struct cat_command_index*       cmd_index;          /* pointer to commands index storage (one item per command) */
+    struct cat_command_index const* prebuilt_cmd_index; /* pointer to prebuilt commands index (used instead of cmd_index) */
+
+    /* optional commands names hash table used by cat_search_command_by_name, if not configured (NULL slots) */
+    /* then commands are searched linearly (item index is global command index) */
+    struct cat_hash_table cmd_hash;
+
+    /* optional arena for names hash tables built by cat_init, if not configured (NULL) */
+    /* then command groups and variables (and commands without cmd_hash) are searched linearly */
+    /* each table takes 2 * number of named items rounded up to power of two slots */
+    /* so 4 * (commands + command groups + variables) slots are always enough */
+    uint16_t* hash_arena;      /* pointer to hash tables slots storage */
+    size_t    hash_arena_size; /* hash tables slots storage length (number of slots) */
+
+    /* flag that trie, commands index and hash tables are already built (e.g. generated by catgen) */
+    /* if set, then cat_init only uses prebuilt tables, so they can be placed in read-only memory */
+    bool tables_prebuilt;
+
+    /* optional timeouts measured by cat_tick, if not configured (0) then disabled */
+    /* hold timeout exits hold state with ERROR response, char timeout resets partially received line with ERROR response */
+    uint32_t hold_timeout_ms; /* default hold state timeout in ms (used when command has no own timeout) */
+    uint32_t char_timeout_ms; /* maximum time in ms between chars of single command line */
 };
 
 /* strcuture with unsolicited command buffered infos */
@@ -336,6 +574,14 @@ typedef enum
     CAT_FSM_TYPE__TOTAL_NUM,
 } cat_fsm_type;
 
+/* structure with output arbiter statistics of single state machine */
+struct cat_write_stats
+{
+    uint32_t writes;         /* number of granted lines (flushes) */
+    uint32_t max_wait_steps; /* worst-case wait for output in service steps */
+    uint32_t max_wait_ms;    /* worst-case wait for output in ms (measured with time passed by cat_tick) */
+};
+
 struct cat_unsolicited_fsm
 {
     cat_unsolicited_state state; /* current unsolicited fsm state */
@@ -370,6 +616,21 @@ struct cat_object
     size_t position;     /* position of actually parsed char in arguments string */
     size_t write_size;   /* size of parsed buffer hex or buffer string */
     size_t commands_num; /* computed total number of registered commands */
+    size_t trie_node;    /* current command names trie node (0 - root or no match) */
+
+    struct cat_trie_node const* trie;       /* command names trie (prebuilt or built in descriptor storage, NULL - not used) */
+    uint16_t const*             trie_order; /* sorted commands order used by trie */
+
+    struct cat_command_index const* cmd_index; /* flattened commands index (prebuilt or built in descriptor storage, NULL - not used) */
+
+    size_t  arg_size;   /* number of bytes of parsed buffer variable stored in variable data */
+    size_t  arg_offset; /* number of bytes of parsed buffer variable already passed to chunk handler */
+    uint8_t arg_state;  /* state of buffer variable parser */
+    uint8_t arg_byte;   /* partially parsed byte of hex buffer variable */
+
+    struct cat_hash_table cmd_hash;   /* commands names hash table (prebuilt or built in hash arena) */
+    struct cat_hash_table group_hash; /* command groups names hash table (built in hash arena) */
+    struct cat_hash_table var_hash;   /* variables names hash table keyed by command (built in hash arena) */
 
     struct cat_command const*  cmd;      /* pointer to current command descriptor */
     struct cat_variable const* var;      /* pointer to current variable descriptor */
@@ -381,11 +642,49 @@ struct cat_object
     bool        hold_state_flag;     /* status of hold state (independent from fsm states) */
     int         hold_exit_status;    /* hold exit parameter with status */
     const char* write_buf;           /* working buffer pointer used for asynch writing to io */
+    size_t      write_position;      /* position of next char to write from working buffer */
+    const char* write_data;          /* pointer to response buffer written in main buffer write state */
+    const char* write_new_line;      /* new line chars written before and after response buffer */
+    bool        write_raw;           /* flag that response buffer is written without new line chars */
     int         write_state;         /* before, data, after flush io write state */
     cat_state   write_state_after;   /* parser state to set after flush io write */
     bool        implicit_write_flag; /* flag that implicit write was detected */
+    uint8_t     atcmd_buf_index;     /* index of atcmd working buffer used by parser (0 - buf, 1 - atcmd_buf2) */
+    bool        flush_pending;       /* flag that final response is flushed in background (next command is received meanwhile) */
+    bool        flush_ok;            /* flag that OK acknowledge is flushed in background after response */
+    bool        stream_args_flag;    /* flag that write arguments of current command are parsed on the fly */
+
+    struct cat_data_phase data_phase;      /* current raw data phase request */
+    size_t                data_position;   /* number of raw data bytes received in data phase */
+    size_t                data_fill;       /* number of raw data bytes stored in data phase buffer */
+    bool                  data_error;      /* flag that data phase handler reported error */
+    bool                  data_phase_flag; /* flag that data phase was requested by command handler */
+    size_t                capture_left;    /* number of raw bytes left to capture to command capture ring */
 
     cat_prompt_detected_handler prompt_handler; /* callback function for prompt character detection (e.g., '>') */
+    cat_notify_handler          notify_handler; /* callback function for waking up service task (NULL - disabled) */
+    cat_stop_reason             wait_reason;    /* reason of waiting after last service step */
+
+    const uint8_t* feed_data;      /* pointer to input data pushed by cat_feed (NULL - input is pulled by io read) */
+    size_t         feed_size;      /* length of input data pushed by cat_feed */
+    size_t         feed_position;  /* position of next char to consume from pushed input data */
+    bool           input_starved;  /* flag that last service step was waiting for input char */
+    bool           output_blocked; /* flag that last service step could not write char to output stream */
+    bool           capture_full;   /* flag that last service step could not copy raw byte to full capture ring */
+
+    uint32_t now_ms;          /* current time in ms passed by last cat_tick call */
+    uint32_t last_char_ms;    /* time of last received char */
+    uint32_t hold_start_ms;   /* time of entering hold state */
+    uint32_t hold_timeout_ms; /* timeout of current hold state (0 - disabled) */
+
+    size_t          tx_head; /* index of next byte queued in transmit ring */
+    volatile size_t tx_tail; /* index of first not transmitted byte in transmit ring (advanced by cat_tx_complete) */
+    volatile size_t tx_len;  /* length of span being transmitted (0 - transmitter idle) */
+
+    uint32_t               steps;                                     /* service steps counter (used to measure output wait) */
+    uint32_t               write_wait_step[CAT_FSM_TYPE__TOTAL_NUM];  /* service step of starting wait for output */
+    uint32_t               write_wait_ms[CAT_FSM_TYPE__TOTAL_NUM];    /* time of starting wait for output */
+    struct cat_write_stats write_stats[CAT_FSM_TYPE__TOTAL_NUM];      /* output arbiter statistics */
 
     struct cat_unsolicited_fsm unsolicited_fsm;
 };
@@ -410,6 +709,111 @@ void cat_init(struct cat_object* self, const struct cat_descriptor* desc, const
  */
 cat_status cat_service(struct cat_object* self);
 
+/**
+ * Function used to run at command parser to completion (run-to-completion variant of cat_service).
+ * Parser state machines are run under single mutex lock until input is exhausted,
+ * output stream cannot accept next char, command handler enabled hold state,
+ * state machines have nothing to do or steps budget is exhausted.
+ * Commands handlers will be call from this function context.
+ *
+ * @param self pointer to at command parser object
+ * @param max_steps maximum number of state machines steps (each step is equal to single cat_service call)
+ * @param reason pointer to returned stop reason (optionally - can be null)
+ * @return status of last step according to cat_service
+ */
+cat_status cat_service_run(struct cat_object* self, size_t max_steps, cat_stop_reason* reason);
+
+/**
+ * Function used to pass monotonic time to at command parser (e.g. from systick or service task).
+ * Hold state and inter-char timeouts are measured with the time passed to this function,
+ * so their resolution depends on calling period. Time counter may overflow.
+ * When timeout expires, ERROR response is sent by next service call (notify callback is called).
+ *
+ * @param self pointer to at command parser object
+ * @param now_ms current time in milliseconds
+ * @return CAT_STATUS_OK on success, otherwise error code
+ */
+cat_status cat_tick(struct cat_object* self, uint32_t now_ms);
+
+/**
+ * Function used to get output arbiter statistics (e.g. to check worst-case unsolicited event latency).
+ *
+ * @param self pointer to at command parser object
+ * @param fsm type of state machine
+ * @param stats pointer to returned statistics
+ * @return CAT_STATUS_OK on success, otherwise error code
+ */
+cat_status cat_get_write_stats(struct cat_object* self, cat_fsm_type fsm, struct cat_write_stats* stats);
+
+/**
+ * Function used to clear output arbiter statistics of all state machines.
+ *
+ * @param self pointer to at command parser object
+ * @return CAT_STATUS_OK on success, otherwise error code
+ */
+cat_status cat_reset_write_stats(struct cat_object* self);
+
+/**
+ * Function used to check what at command parser is waiting for after last service call.
+ * CAT_STOP_REASON_NONE means that service should be called again immediately,
+ * otherwise service task can block until input is available, output is ready,
+ * hold state exit is requested (see cat_set_notify_handler).
+ * CAT_STOP_REASON_CAPTURE_FULL means that service should be called again after captured bytes are read from capture ring.
+ *
+ * @param self pointer to at command parser object
+ * @param reason pointer to returned wait reason
+ * @return CAT_STATUS_OK on success, otherwise error code
+ */
+cat_status cat_get_wait_reason(struct cat_object* self, cat_stop_reason* reason);
+
+/**
+ * Function used to signal that new input data is available (e.g. from uart rx isr).
+ * Only notify callback is called (without mutex locking), so it is safe to call it from isr.
+ *
+ * @param self pointer to at command parser object
+ */
+void cat_input_available(struct cat_object* self);
+
+/**
+ * Function used to signal that output stream can accept next chars again (e.g. from uart tx isr).
+ * It wakes up service task stopped with CAT_STOP_REASON_OUTPUT_BLOCKED when io write or write_buf is used
+ * (with io start_tx, cat_tx_complete is used instead).
+ * Only notify callback is called (without mutex locking), so it is safe to call it from isr.
+ *
+ * @param self pointer to at command parser object
+ */
+void cat_output_ready(struct cat_object* self);
+
+/**
+ * Function used to signal that asynchronous transmission started by io start_tx is finished (e.g. from dma isr).
+ * Transmitted bytes are released from transmit ring, not transmitted bytes are passed again to next start_tx.
+ * Next span is started by service call, so notify callback is called (without mutex locking, safe to call from isr).
+ *
+ * @param self pointer to at command parser object
+ * @param n number of transmitted bytes (not greater than length passed to start_tx)
+ */
+void cat_tx_complete(struct cat_object* self, size_t n);
+
+/**
+ * Function used to push block of input data (e.g. received by DMA) to at command parser.
+ * Parser state machines are run under single mutex lock as long as input data can be consumed.
+ * Processing stops when all data is consumed and parser waits for next char,
+ * when output stream cannot accept next char, when command handler enabled hold state,
+ * when state machines have nothing to do or when steps budget is exhausted.
+ * Not consumed data should be pushed again later (e.g. after cat_hold_exit or when output is ready).
+ * Commands handlers will be call from this function context.
+ * Pull mode io read interface is not used during this call.
+ *
+ * @param self pointer to at command parser object
+ * @param data pointer to input data
+ * @param len length of input data
+ * @param consumed pointer to returned number of consumed bytes (0 when mutex cannot be locked)
+ * @param max_steps maximum number of state machines steps (each step is equal to single cat_service call)
+ * @param reason pointer to returned stop reason (optionally - can be null, not set when mutex cannot be locked)
+ * @return status of last step according to cat_service_run
+ */
+cat_status cat_feed(struct cat_object* self, const uint8_t* data, size_t len, size_t* consumed, size_t max_steps, cat_stop_reason* reason);
+
 /**
  * Function return flag which indicating internal busy state.
  * It is used to determine whether external application modules can use shared input / output interfaces functions.
@@ -551,6 +955,172 @@ cat_status cat_is_unsolicited_event_buffered(struct cat_object* self, struct cat
  */
 cat_status cat_set_prompt_handler(struct cat_object* self, cat_prompt_detected_handler handler);
 
+/**
+ * Function used to request raw data phase from write or run command handler.
+ * Command handler should return value returned by this function. Then prompt ("> ") is printed
+ * and exactly requested number of raw bytes is received without parsing, next OK (or ERROR) is printed.
+ * It is called from command handler (parser mutex is already locked there), so it does not lock mutex.
+ *
+ * @param self pointer to at command parser object
+ * @param phase pointer to data phase request (it is copied)
+ * @return CAT_RETURN_STATE_DATA_PHASE - data phase is requested
+ *         CAT_RETURN_STATE_ERROR - wrong request or not called from write or run command handler
+ */
+cat_return_state cat_start_data_phase(struct cat_object* self, const struct cat_data_phase* phase);
+
+/**
+ * Function used to set notify callback.
+ * Callback is called by cat_hold_exit, cat_trigger_unsolicited_event (and its variants), cat_input_available,
+ * cat_output_ready, cat_tx_complete and by cat_tick when timeout expires,
+ * so service task can sleep while parser is waiting (see cat_get_wait_reason).
+ *
+ * @param self pointer to at command parser object
+ * @param handler callback function to be called when parser has new work to do, NULL to disable
+ * @return CAT_STATUS_OK on success, otherwise error code
+ */
+cat_status cat_set_notify_handler(struct cat_object* self, cat_notify_handler handler);
+
+/**
+ * Function used to build keywords hash table of enum variable in caller-provided slots storage.
+ * Must be called before parser uses the table.
+ *
+ * @param keywords pointer to keywords table
+ * @param slots pointer to slots storage
+ * @param slots_num slots storage length (at least twice number of keywords, rounded up to power of two)
+ */
+void cat_enum_hash_init(struct cat_enum* keywords, uint16_t* slots, size_t slots_num);
+
+/**
+ * Function used to append signed decimal number to response buffer (e.g. from read or test command handler).
+ * Buffer is always null terminated, so max_data_size must include space for terminator.
+ * Function does not lock parser, so it can be called from any handler.
+ *
+ * @param data pointer to response buffer
+ * @param data_size pointer to current length of response buffer (increased on success)
+ * @param max_data_size maximum length of buffer pointed by data pointer
+ * @param val value to append
+ * @return 0 on success, -1 if there is no space left (buffer is not modified)
+ */
+int cat_append_int(uint8_t* data, size_t* data_size, const size_t max_data_size, int64_t val);
+
+/**
+ * Function used to append unsigned decimal number to response buffer (see cat_append_int).
+ *
+ * @param data pointer to response buffer
+ * @param data_size pointer to current length of response buffer (increased on success)
+ * @param max_data_size maximum length of buffer pointed by data pointer
+ * @param val value to append
+ * @return 0 on success, -1 if there is no space left (buffer is not modified)
+ */
+int cat_append_uint(uint8_t* data, size_t* data_size, const size_t max_data_size, uint64_t val);
+
+/**
+ * Function used to append "0x" prefixed, zero padded hexadecimal number to response buffer (see cat_append_int).
+ *
+ * @param data pointer to response buffer
+ * @param data_size pointer to current length of response buffer (increased on success)
+ * @param max_data_size maximum length of buffer pointed by data pointer
+ * @param val value to append
+ * @param width value width in bytes (1 to 8), number of printed digits is twice as much
+ * @return 0 on success, -1 if there is no space left or width is invalid (buffer is not modified)
+ */
+int cat_append_hex(uint8_t* data, size_t* data_size, const size_t max_data_size, uint64_t val, size_t width);
+
+/*
+ * structure with single-producer (e.g. uart rx isr) single-consumer (at command parser) lock-free input ring
+ * Indexes and counters are accessed only by cat_rx_ring functions. Producer stores head after ring storage is written
+ * and consumer loads head before ring storage is read (tail is handled the same way in opposite direction),
+ * so bytes counted by cat_rx_ring_available are always visible to consumer. With CAT_RX_RING_ATOMICS it is guaranteed
+ * by acquire loads and release stores, otherwise by volatile accesses separated by CAT_RX_RING_BARRIER.
+ */
+struct cat_rx_ring
+{
+    uint8_t*          buf;      /* pointer to ring storage */
+    size_t            size;     /* ring storage length (one byte is always left free) */
+    cat_rx_ring_index head;     /* index of next byte written by producer */
+    cat_rx_ring_index tail;     /* index of next byte read by consumer */
+    cat_rx_ring_index received; /* number of bytes accepted by ring (written by producer) */
+    cat_rx_ring_index overruns; /* number of bytes dropped because ring was full (written by producer) */
+};
+
+/**
+ * Function used to initialize input ring (must be called before producer and consumer are started).
+ *
+ * @param ring pointer to input ring object
+ * @param buf pointer to ring storage
+ * @param size ring storage length
+ */
+void cat_rx_ring_init(struct cat_rx_ring* ring, uint8_t* buf, size_t size);
+
+/**
+ * Function used by producer (e.g. uart rx isr or dma half/full transfer isr) to put received bytes into ring.
+ * Bytes which do not fit into ring are dropped and counted as overruns.
+ *
+ * @param ring pointer to input ring object
+ * @param data pointer to received bytes
+ * @param len number of received bytes
+ * @return number of bytes put into ring
+ */
+size_t cat_rx_ring_write(struct cat_rx_ring* ring, const uint8_t* data, size_t len);
+
+/**
+ * Function used by consumer to read block of bytes from ring (e.g. to push it by cat_feed).
+ *
+ * @param ring pointer to input ring object
+ * @param data pointer to output buffer
+ * @param len output buffer length
+ * @return number of read bytes
+ */
+size_t cat_rx_ring_read(struct cat_rx_ring* ring, uint8_t* data, size_t len);
+
+/**
+ * Function used by consumer to read single char from ring (compatible with io read interface).
+ *
+ * @param ring pointer to input ring object
+ * @param ch pointer to read char
+ * @return 1 if char was read, 0 if ring is empty
+ */
+int cat_rx_ring_read_char(struct cat_rx_ring* ring, char* ch);
+
+/**
+ * Function used to get number of bytes waiting in ring.
+ *
+ * @param ring pointer to input ring object
+ * @return number of bytes available for consumer
+ */
+size_t cat_rx_ring_available(struct cat_rx_ring* ring);
+
+/**
+ * Function used to get number of bytes which can be put into ring without overrun.
+ *
+ * @param ring pointer to input ring object
+ * @return number of free bytes for producer
+ */
+size_t cat_rx_ring_space(struct cat_rx_ring* ring);
+
+/**
+ * Function used to get number of bytes dropped because ring was full.
+ *
+ * @param ring pointer to input ring object
+ * @return number of dropped bytes since ring initialization
+ */
+size_t cat_rx_ring_overruns(struct cat_rx_ring* ring);
+
+/**
+ * Function used to get number of bytes accepted by ring.
+ *
+ * @param ring pointer to input ring object
+ * @return number of bytes put into ring since ring initialization
+ */
+size_t cat_rx_ring_received(struct cat_rx_ring* ring);
+
+/* macro used to define io read interface function bound to static input ring object */
+#define CAT_RX_RING_IO_READ(func_name, ring)              \
+    static int func_name(char* ch)                        \
+    {                                                     \
+        return cat_rx_ring_read_char(&(ring), ch);        \
+    }
+
 // NOLINTEND
 
 #ifdef __cplusplus
@@ -0,0 +1,168 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+#define HEX_DATA_SIZE 512
+#define ROUNDS_NUM 2000
+
+static uint8_t hex_data[HEX_DATA_SIZE];
+static uint8_t hex_pattern[HEX_DATA_SIZE];
+
+static char input_text[2 * HEX_DATA_SIZE + 16];
+static size_t input_size;
+static size_t input_index;
+
+static size_t output_size;
+
+static struct cat_variable vars[] = {
+        {
+                .type = CAT_VAR_BUF_HEX,
+                .data = hex_data,
+                .data_size = sizeof(hex_data)
+        }
+};
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+HEX",
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0])
+        }
+};
+
+static char buf[4 * HEX_DATA_SIZE + 64];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = (uint8_t *)buf,
+        .buf_size = sizeof(buf)
+};
+
+static int write_char(char ch)
+{
+        output_size++;
+        return 1;
+}
+
+static size_t write_buf(const char *data, size_t len)
+{
+        output_size += len;
+        return len;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= input_size)
+                return 0;
+
+        *ch = input_text[input_index++];
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char,
+        .write_buf = write_buf
+};
+
+static void prepare_input(const char *text)
+{
+        strcpy(input_text, text);
+        input_size = strlen(input_text);
+        input_index = 0;
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+        char *p;
+        size_t i;
+        clock_t start;
+        double parse_ns, format_ns;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        for (i = 0; i < sizeof(hex_pattern); i++)
+                hex_pattern[i] = (uint8_t)(i * 131 + 7);
+
+        strcpy(input_text, "AT+HEX=");
+        p = input_text + strlen(input_text);
+        for (i = 0; i < sizeof(hex_pattern); i++)
+                p += sprintf(p, (i & 1) ? "%02x" : "%02X", hex_pattern[i]);
+        strcpy(p, "\n");
+        input_size = strlen(input_text);
+
+        /* parse of write arguments is measured in parse_write_args state only (after whole line is received) */
+        parse_ns = 0;
+        for (i = 0; i < ROUNDS_NUM; i++) {
+                input_index = 0;
+                memset(hex_data, 0, sizeof(hex_data));
+                while (cat_service(&at) != 0) {
+                        if (input_index < input_size)
+                                continue;
+                        start = clock();
+                        while (cat_service(&at) != 0) {};
+                        parse_ns += (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC;
+                        break;
+                }
+                assert(memcmp(hex_data, hex_pattern, sizeof(hex_data)) == 0);
+        }
+
+        prepare_input("AT+HEX?\n");
+        format_ns = 0;
+        for (i = 0; i < ROUNDS_NUM; i++) {
+                input_index = 0;
+                output_size = 0;
+                start = clock();
+                while (cat_service(&at) != 0) {};
+                format_ns += (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC;
+                assert(output_size == strlen("\n+HEX=\n\nOK\n") + 2 * HEX_DATA_SIZE);
+        }
+
+        printf("hexbuf %u bytes  write: %7.1f MB/s  read: %7.1f MB/s\n", (unsigned)HEX_DATA_SIZE,
+               (double)HEX_DATA_SIZE * ROUNDS_NUM * 1e3 / parse_ns, (double)HEX_DATA_SIZE * ROUNDS_NUM * 1e3 / format_ns);
+
+        return 0;
+}
@@ -0,0 +1,159 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+#define MAX_COMMANDS_NUM 1000
+#define GROUP_COMMANDS_NUM 10
+#define MAX_GROUPS_NUM (MAX_COMMANDS_NUM / GROUP_COMMANDS_NUM)
+#define LOOKUPS_NUM 10000
+
+static uint8_t var_data;
+
+static struct cat_variable vars[] = {
+        {
+                .name = "MODE",
+                .type = CAT_VAR_UINT_DEC,
+                .data = &var_data,
+                .data_size = sizeof(var_data)
+        },
+        {
+                .name = "LEVEL",
+                .type = CAT_VAR_UINT_DEC,
+                .data = &var_data,
+                .data_size = sizeof(var_data)
+        }
+};
+
+static char cmd_names[MAX_COMMANDS_NUM][8];
+static char group_names[MAX_GROUPS_NUM][8];
+static struct cat_command cmds[MAX_COMMANDS_NUM];
+static struct cat_command_group groups[MAX_GROUPS_NUM];
+static struct cat_command_group *cmd_desc[MAX_GROUPS_NUM];
+
+static char buf[MAX_COMMANDS_NUM];
+static uint16_t hash_arena[4 * (MAX_COMMANDS_NUM + MAX_GROUPS_NUM + MAX_COMMANDS_NUM * 2)];
+
+static int write_char(char ch)
+{
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        return 0;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_commands(void)
+{
+        size_t i;
+
+        for (i = 0; i < MAX_COMMANDS_NUM; i++) {
+                snprintf(cmd_names[i], sizeof(cmd_names[i]), "+C%04u", (unsigned)i);
+                cmds[i].name = cmd_names[i];
+                cmds[i].var = vars;
+                cmds[i].var_num = sizeof(vars) / sizeof(vars[0]);
+        }
+
+        for (i = 0; i < MAX_GROUPS_NUM; i++) {
+                snprintf(group_names[i], sizeof(group_names[i]), "G%03u", (unsigned)i);
+                groups[i].name = group_names[i];
+                groups[i].cmd = &cmds[i * GROUP_COMMANDS_NUM];
+                groups[i].cmd_num = GROUP_COMMANDS_NUM;
+                cmd_desc[i] = &groups[i];
+        }
+}
+
+static double measure(struct cat_object *at, size_t commands_num)
+{
+        size_t i;
+        clock_t start;
+        struct cat_command const *cmd;
+
+        start = clock();
+        for (i = 0; i < LOOKUPS_NUM; i++) {
+                cmd = cat_search_command_by_name(at, cmd_names[(i * 7919) % commands_num]);
+                assert(cmd == &cmds[(i * 7919) % commands_num]);
+                assert(cat_search_variable_by_name(at, cmd, "LEVEL") == &vars[1]);
+                assert(cat_search_command_group_by_name(at, group_names[(i * 7919) % commands_num / GROUP_COMMANDS_NUM]) != NULL);
+        }
+
+        return (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / LOOKUPS_NUM;
+}
+
+static void benchmark(size_t commands_num)
+{
+        struct cat_object at;
+        struct cat_descriptor desc = {
+                .cmd_group = cmd_desc,
+                .cmd_group_num = commands_num / GROUP_COMMANDS_NUM,
+
+                .buf = (uint8_t *)buf,
+                .buf_size = sizeof(buf)
+        };
+        double linear_ns, hash_ns;
+
+        cat_init(&at, &desc, &iface, NULL);
+        assert(cat_search_command_by_name(&at, "+C9999") == NULL);
+        assert(cat_search_command_group_by_name(&at, "G999") == NULL);
+        assert(cat_search_variable_by_name(&at, &cmds[0], "NONE") == NULL);
+        linear_ns = measure(&at, commands_num);
+
+        desc.hash_arena = hash_arena;
+        desc.hash_arena_size = sizeof(hash_arena) / sizeof(hash_arena[0]);
+
+        cat_init(&at, &desc, &iface, NULL);
+        assert(cat_search_command_by_name(&at, "+C9999") == NULL);
+        assert(cat_search_command_group_by_name(&at, "G999") == NULL);
+        assert(cat_search_variable_by_name(&at, &cmds[0], "NONE") == NULL);
+        assert(cat_search_variable_by_name(&at, &cmds[commands_num - 1], "MODE") == &vars[0]);
+        hash_ns = measure(&at, commands_num);
+
+        printf("commands: %4u  linear: %9.1f ns/lookup  hash: %7.1f ns/lookup\n", (unsigned)commands_num, linear_ns, hash_ns);
+}
+
+int main(int argc, char **argv)
+{
+        prepare_commands();
+
+        benchmark(10);
+        benchmark(100);
+        benchmark(1000);
+
+        return 0;
+}
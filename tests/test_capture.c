@@ -0,0 +1,253 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char ack_results[256];
+static char write_results[256];
+
+static uint8_t rx_buf[64];
+static struct cat_rx_ring rx_ring;
+
+static uint8_t small_buf[8];
+static struct cat_rx_ring small_ring;
+
+static uint16_t recv_len;
+static uint8_t recv_link;
+static uint64_t read_len;
+
+static char const *input_text;
+static size_t input_size;
+static size_t input_index;
+
+static cat_return_state cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        char data_buf[64];
+        size_t n;
+
+        n = cat_rx_ring_read(&rx_ring, (uint8_t *)data_buf, sizeof(data_buf) - 1);
+        data_buf[n] = 0;
+
+        sprintf(write_results + strlen(write_results), " %s:%d:%d:%s", cmd->name, (int)recv_link, (int)recv_len, data_buf);
+        return CAT_RETURN_STATE_OK;
+}
+
+static struct cat_variable vars[] = {
+        {
+                .type = CAT_VAR_UINT_DEC,
+                .data = &recv_link,
+                .data_size = sizeof(recv_link)
+        },
+        {
+                .type = CAT_VAR_UINT_DEC,
+                .data = &recv_len,
+                .data_size = sizeof(recv_len)
+        }
+};
+
+static struct cat_variable read_vars[] = {
+        {
+                .type = CAT_VAR_NUM_HEX,
+                .data = &read_len,
+                .data_size = sizeof(read_len)
+        }
+};
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+RECV",
+                .write = cmd_write,
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0]),
+                .capture_ring = &rx_ring,
+                .capture_var = 1
+        },
+        {
+                .name = "LIRD",
+                .var = &vars[1],
+                .var_num = 1,
+                .capture_ring = &rx_ring,
+                .capture_var = 0
+        },
+        {
+                .name = "+BIG",
+                .var = &vars[1],
+                .var_num = 1,
+                .capture_ring = &small_ring,
+                .capture_var = 0
+        },
+        {
+                .name = "+QRD",
+                .var = read_vars,
+                .var_num = sizeof(read_vars) / sizeof(read_vars[0]),
+                .capture_ring = &rx_ring,
+                .capture_var = 0
+        },
+};
+
+static char buf[32];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf)
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= input_size)
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text, size_t size)
+{
+        input_text = text;
+        input_size = size;
+        input_index = 0;
+
+        memset(ack_results, 0, sizeof(ack_results));
+        memset(write_results, 0, sizeof(write_results));
+}
+
+static const char test_case_1[] = "\nAT+RECV=1,23\n\"quoted\",AT\r\n0123456789\nAT+RECV=2\nAT\n";
+static const char test_case_2[] = "\n+LIRD: 3\r\n\r\nOAT\n";
+static const uint8_t test_case_3[] = "\nAT+RECV=3,10\nabcdefghijAT\n";
+static const char test_case_4[] = "\nAT+BIG=20\nABCDEFGHIJKLMNOPQRSTAT\n";
+static const char test_case_5[] = "\nAT+QRD=0x4\nwxyzAT\n";
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+        uint8_t data[16];
+        uint8_t big[32];
+        size_t big_size;
+        cat_stop_reason reason;
+        size_t n;
+
+        cat_rx_ring_init(&rx_ring, rx_buf, sizeof(rx_buf));
+        cat_rx_ring_init(&small_ring, small_buf, sizeof(small_buf));
+        cat_init(&at, &desc, &iface, NULL);
+
+        prepare_input(test_case_1, sizeof(test_case_1) - 1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\nERROR\n\nOK\n") == 0);
+        assert(strcmp(write_results, " +RECV:1:23:\"quoted\",AT\r\n0123456789") == 0);
+        assert(cat_rx_ring_available(&rx_ring) == 0);
+
+        prepare_input(test_case_2, sizeof(test_case_2) - 1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\r\nOK\r\n\nOK\n") == 0);
+        assert(cat_rx_ring_read(&rx_ring, data, sizeof(data)) == 3);
+        assert(memcmp(data, "\r\nO", 3) == 0);
+
+        prepare_input("", 0);
+        assert(cat_feed(&at, test_case_3, 17, &n, 1000, NULL) == CAT_STATUS_OK);
+        assert(n == 17);
+        assert(cat_rx_ring_available(&rx_ring) == 3);
+        assert(cat_feed(&at, test_case_3 + 17, sizeof(test_case_3) - 1 - 17, &n, 1000, NULL) == CAT_STATUS_OK);
+        assert(n == sizeof(test_case_3) - 1 - 17);
+        assert(strcmp(ack_results, "\nOK\n\nOK\n") == 0);
+        assert(strcmp(write_results, " +RECV:3:10:abcdefghij") == 0);
+        assert(cat_rx_ring_overruns(&rx_ring) == 0);
+
+        prepare_input(test_case_4, sizeof(test_case_4) - 1);
+        big_size = 0;
+        while (cat_service(&at) != 0) {};
+        assert(cat_get_wait_reason(&at, &reason) == CAT_STATUS_OK);
+        while (reason == CAT_STOP_REASON_CAPTURE_FULL) {
+                assert(cat_rx_ring_space(&small_ring) == 0);
+                big_size += cat_rx_ring_read(&small_ring, big + big_size, sizeof(big) - big_size);
+                while (cat_service(&at) != 0) {};
+                assert(cat_get_wait_reason(&at, &reason) == CAT_STATUS_OK);
+        }
+        assert(strcmp(ack_results, "\nOK\n\nOK\n") == 0);
+        big_size += cat_rx_ring_read(&small_ring, big + big_size, sizeof(big) - big_size);
+        assert(big_size == 20);
+        assert(memcmp(big, "ABCDEFGHIJKLMNOPQRST", 20) == 0);
+
+        prepare_input("", 0);
+        assert(cat_feed(&at, (const uint8_t *)test_case_4, sizeof(test_case_4) - 1, &n, 1000, &reason) == CAT_STATUS_OK);
+        assert(reason == CAT_STOP_REASON_CAPTURE_FULL);
+        assert(n == 11 + 7);
+        assert(cat_rx_ring_read(&small_ring, big, sizeof(big)) == 7);
+        assert(cat_feed(&at, (const uint8_t *)test_case_4 + 18, sizeof(test_case_4) - 1 - 18, &n, 1000, &reason) == CAT_STATUS_OK);
+        assert(reason == CAT_STOP_REASON_CAPTURE_FULL);
+        assert(n == 7);
+        assert(cat_rx_ring_read(&small_ring, big + 7, sizeof(big) - 7) == 7);
+        assert(cat_feed(&at, (const uint8_t *)test_case_4 + 25, sizeof(test_case_4) - 1 - 25, &n, 1000, &reason) == CAT_STATUS_OK);
+        assert(n == sizeof(test_case_4) - 1 - 25);
+        assert(cat_rx_ring_read(&small_ring, big + 14, sizeof(big) - 14) == 6);
+        assert(memcmp(big, "ABCDEFGHIJKLMNOPQRST", 20) == 0);
+        assert(strcmp(ack_results, "\nOK\n\nOK\n") == 0);
+        assert(cat_rx_ring_overruns(&small_ring) == 0);
+
+        prepare_input(test_case_5, sizeof(test_case_5) - 1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\nOK\n") == 0);
+        assert(read_len == 4);
+        assert(cat_rx_ring_read(&rx_ring, data, sizeof(data)) == 4);
+        assert(memcmp(data, "wxyz", 4) == 0);
+
+        return 0;
+}
@@ -0,0 +1,194 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+#include "test_catgen_handlers.h"
+#include "test_catgen_tables.h"
+
+uint8_t print_x;
+int16_t print_y;
+char print_msg[16];
+uint32_t scan_mask;
+uint8_t scan_mode;
+int32_t scan_rssi;
+struct cat_rx_ring scan_ring;
+uint16_t scan_cell;
+uint8_t scan_band;
+
+static char run_results[256];
+static char ack_results[256];
+
+static char const *input_text;
+static size_t input_index;
+
+cat_return_state print_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        strcat(run_results, " W_");
+        strcat(run_results, cmd->name);
+        strcat(run_results, ":");
+        strncat(run_results, (const char *)data, data_size);
+        return CAT_RETURN_STATE_OK;
+}
+
+cat_return_state print_run(const struct cat_command *cmd)
+{
+        strcat(run_results, " R_");
+        strcat(run_results, cmd->name);
+        return CAT_RETURN_STATE_OK;
+}
+
+int scan_element(const struct cat_command *cmd, const size_t index)
+{
+        (void)cmd;
+        (void)index;
+        return 0;
+}
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(run_results, 0, sizeof(run_results));
+        memset(ack_results, 0, sizeof(ack_results));
+}
+
+static uint8_t buf[256];
+static struct cat_trie_node trie[64];
+static uint16_t trie_order[TEST_COMMANDS_NUM];
+static struct cat_command_index cmd_index[TEST_COMMANDS_NUM];
+
+static struct cat_descriptor runtime_desc = {
+        .buf = buf,
+        .buf_size = sizeof(buf),
+
+        .trie = trie,
+        .trie_size = sizeof(trie) / sizeof(trie[0]),
+        .trie_order = trie_order,
+
+        .cmd_index = cmd_index
+};
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+        size_t i;
+
+        runtime_desc.cmd_group = test_desc.cmd_group;
+        runtime_desc.cmd_group_num = test_desc.cmd_group_num;
+
+        assert(test_desc.char_timeout_ms == 200);
+        assert(test_desc.atcmd_buf2_size == 128);
+        assert(test_desc.hold_timeout_ms == 0);
+        assert(TEST_CMD_PRESET->hold_timeout_ms == 1000);
+        assert(TEST_CMD_SCAN->stream_args != false);
+        assert(TEST_CMD_PRESET->stream_args == false);
+        assert(TEST_CMD_SCAN->capture_ring == &scan_ring);
+        assert(TEST_CMD_SCAN->capture_var == 0);
+        assert(TEST_CMD_SCAN->var_num == 4);
+        assert(TEST_CMD_SCAN->var[1].type == CAT_VAR_SKIP);
+        assert(TEST_CMD_SCAN->var[1].data == NULL);
+        assert(TEST_CMD_SCAN->var[1].data_size == 2);
+        assert(TEST_CMD_SCAN->var[2].keywords->num == 3);
+        assert(TEST_CMD_SCAN->var[2].keywords->hash.slots != NULL);
+        assert(strcmp(TEST_CMD_SCAN->var[2].keywords->names[2], "WCDMA") == 0);
+        assert(TEST_CMD_SCAN->var[3].scale == 1);
+        assert(TEST_CMD_SCAN->repeat_var_num == 2);
+        assert(TEST_CMD_SCAN->repeat_var[0].data == &scan_cell);
+        assert(TEST_CMD_SCAN->repeat_var[1].keywords->num == 2);
+        assert(TEST_CMD_SCAN->element == scan_element);
+
+        cat_init(&at, &runtime_desc, &iface, NULL);
+
+        for (i = 0; i < TEST_COMMANDS_NUM; i++) {
+                assert(test_desc.prebuilt_trie_order[i] == trie_order[i]);
+                assert(test_desc.prebuilt_cmd_index[i].cmd == cmd_index[i].cmd);
+                assert(test_desc.prebuilt_cmd_index[i].group == cmd_index[i].group);
+        }
+        for (i = 0; i < test_desc.trie_size; i++) {
+                assert(test_desc.prebuilt_trie[i].child == trie[i].child);
+                assert(test_desc.prebuilt_trie[i].sibling == trie[i].sibling);
+                assert(test_desc.prebuilt_trie[i].begin == trie[i].begin);
+                assert(test_desc.prebuilt_trie[i].end == trie[i].end);
+                assert(test_desc.prebuilt_trie[i].ch == trie[i].ch);
+        }
+
+        cat_init(&at, &test_desc, &iface, NULL);
+
+        for (i = 0; i < TEST_COMMANDS_NUM; i++)
+                assert(cat_search_command_by_name(&at, test_cmds[i].name) == &test_cmds[i]);
+        assert(cat_search_command_by_name(&at, "+PRIN") == NULL);
+        assert(cat_search_command_by_name(&at, "#HELP") == NULL);
+        assert(cat_search_command_by_name(&at, "+SCAN") == TEST_CMD_SCAN);
+        assert(cat_search_command_by_name(&at, "#help") == TEST_CMD_HELP);
+
+        prepare_input("\nAT+PRINT=?\nAT+SCAN=?\nAT+PRI\nAT+PR\nAT#HELP\nATD12\n");
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n+PRINT=<X:UINT8[RW]>,<Y:INT16[WO]>,<MSG:STRING[RW]>\nPrinting at (X,Y).\n\nOK\n\n+SCAN=<HEX32[WO]>,<SKIP[RW]>,<MODE:ENUM[RW]>,<RSSI:FIXED[RW]>\n\nOK\n\nOK\n\nERROR\n\nOK\n\nOK\n") == 0);
+        assert(strcmp(run_results, " R_+PRINT R_#help W_D:12") == 0);
+
+        prepare_input("\nAT+PRINT=1,-2,\"abc\"\nAT+PRINT?\n");
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\n+PRINT=1,0,\"abc\"\n\nOK\n") == 0);
+        assert(print_x == 1);
+        assert(print_y == -2);
+        assert(strcmp(print_msg, "abc") == 0);
+
+        return 0;
+}
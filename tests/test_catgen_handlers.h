@@ -0,0 +1,20 @@
+#ifndef TEST_CATGEN_HANDLERS_H
+#define TEST_CATGEN_HANDLERS_H
+
+#include "cat.h"
+
+extern uint8_t print_x;
+extern int16_t print_y;
+extern char print_msg[16];
+extern uint32_t scan_mask;
+extern uint8_t scan_mode;
+extern int32_t scan_rssi;
+extern struct cat_rx_ring scan_ring;
+extern uint16_t scan_cell;
+extern uint8_t scan_band;
+
+cat_return_state print_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num);
+cat_return_state print_run(const struct cat_command *cmd);
+int scan_element(const struct cat_command *cmd, const size_t index);
+
+#endif /* TEST_CATGEN_HANDLERS_H */
@@ -0,0 +1,186 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char run_results[256];
+static char ack_results[256];
+
+static char const *input_text;
+static size_t input_index;
+
+static cat_return_state cmd_run(const struct cat_command *cmd)
+{
+        strcat(run_results, " R_");
+        strcat(run_results, cmd->name);
+        return CAT_RETURN_STATE_OK;
+}
+
+static struct cat_command cmds_1[] = {
+        {
+                .name = "+A1",
+                .run = cmd_run
+        },
+        {
+                .name = "+A2",
+                .run = cmd_run
+        },
+};
+
+static struct cat_command cmds_2[] = {
+        {
+                .name = "+B1",
+                .run = cmd_run
+        },
+};
+
+static struct cat_command cmds_3[] = {
+        {
+                .name = "+C1",
+                .run = cmd_run
+        },
+        {
+                .name = "+C2",
+                .run = cmd_run
+        },
+};
+
+static char buf[128];
+static struct cat_command_index cmd_index[5];
+
+static struct cat_command_group cmd_group_1 = {
+        .name = "a",
+        .cmd = cmds_1,
+        .cmd_num = sizeof(cmds_1) / sizeof(cmds_1[0]),
+};
+
+static struct cat_command_group cmd_group_2 = {
+        .name = "b",
+        .cmd = cmds_2,
+        .cmd_num = sizeof(cmds_2) / sizeof(cmds_2[0]),
+};
+
+static struct cat_command_group cmd_group_3 = {
+        .name = "c",
+        .cmd = cmds_3,
+        .cmd_num = sizeof(cmds_3) / sizeof(cmds_3[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group_1,
+        &cmd_group_2,
+        &cmd_group_3
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+
+        .cmd_index = cmd_index
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(run_results, 0, sizeof(run_results));
+        memset(ack_results, 0, sizeof(ack_results));
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        assert(cmd_index[0].cmd == &cmds_1[0]);
+        assert(cmd_index[2].cmd == &cmds_2[0]);
+        assert(cmd_index[2].group == 1);
+        assert(cmd_index[4].cmd == &cmds_3[1]);
+        assert(cmd_index[4].group == 2);
+
+        assert(cat_search_command_by_name(&at, "+C2") == &cmds_3[1]);
+        assert(cat_search_command_by_name(&at, "+C3") == NULL);
+
+        prepare_input("\nAT+A1\nAT+B\nAT+C2\nAT+C\n");
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\nOK\n\nOK\n\nERROR\n") == 0);
+        assert(strcmp(run_results, " R_+A1 R_+B1 R_+C2") == 0);
+
+        cmd_group_2.disable = true;
+        cmds_3[0].disable = true;
+
+        prepare_input("\nAT+B\nAT+C\nAT+C1\n");
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nERROR\n\nOK\n\nERROR\n") == 0);
+        assert(strcmp(run_results, " R_+C2") == 0);
+
+        cmd_group_2.disable = false;
+
+        prepare_input("\nAT+B\n");
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n") == 0);
+        assert(strcmp(run_results, " R_+B1") == 0);
+
+        return 0;
+}
@@ -0,0 +1,229 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char ack_results[256];
+
+static struct cat_object at;
+
+static uint32_t send_len;
+static uint8_t stage[4];
+static uint8_t recv_buf[8];
+static uint8_t data_results[64];
+static size_t data_results_size;
+static int data_cntr;
+static bool data_fail;
+
+static const uint8_t *feed_begin;
+static const uint8_t *feed_end;
+
+static char const *input_text;
+static size_t input_size;
+static size_t input_index;
+
+static int data_handler(const uint8_t *data, const size_t size, const size_t offset)
+{
+        assert(offset == data_results_size);
+        assert(offset + size <= sizeof(data_results));
+
+        if (feed_begin != NULL)
+                assert((data >= feed_begin) && (data + size <= feed_end));
+
+        memcpy(&data_results[offset], data, size);
+        data_results_size += size;
+        data_cntr++;
+        return (data_fail != false) ? -1 : 0;
+}
+
+static cat_return_state cmd_send_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        struct cat_data_phase phase = {
+                .buf = stage,
+                .buf_size = sizeof(stage),
+                .size = send_len,
+                .handler = data_handler
+        };
+
+        return cat_start_data_phase(&at, &phase);
+}
+
+static cat_return_state cmd_recv_run(const struct cat_command *cmd)
+{
+        struct cat_data_phase phase = {
+                .buf = recv_buf,
+                .buf_size = sizeof(recv_buf),
+                .size = 5
+        };
+
+        return cat_start_data_phase(&at, &phase);
+}
+
+static cat_return_state cmd_bad_run(const struct cat_command *cmd)
+{
+        return CAT_RETURN_STATE_DATA_PHASE;
+}
+
+static struct cat_variable send_vars[] = {
+        {
+                .type = CAT_VAR_UINT_DEC,
+                .data = &send_len,
+                .data_size = sizeof(send_len)
+        }
+};
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+SEND",
+                .write = cmd_send_write,
+                .var = send_vars,
+                .var_num = sizeof(send_vars) / sizeof(send_vars[0]),
+                .need_all_vars = true
+        },
+        {
+                .name = "+RECV",
+                .run = cmd_recv_run
+        },
+        {
+                .name = "+BAD",
+                .run = cmd_bad_run
+        },
+};
+
+static char buf[128];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf)
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= input_size)
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text, size_t size)
+{
+        input_text = text;
+        input_size = size;
+        input_index = 0;
+
+        memset(ack_results, 0, sizeof(ack_results));
+        memset(data_results, 0, sizeof(data_results));
+        memset(recv_buf, 0, sizeof(recv_buf));
+        data_results_size = 0;
+        data_cntr = 0;
+        data_fail = false;
+        feed_begin = NULL;
+        feed_end = NULL;
+}
+
+static const char test_case_1[] = "\nAT+SEND=10\n0\n2AT\r\0+78AT\n";
+static const char test_case_2[] = "\nAT+RECV\nab\ncdAT+BAD\nAT\n";
+static const char test_case_3[] = "\nAT+SEND=6\nERROR!AT\n";
+static const uint8_t test_case_4[] = "\nAT+SEND=12\n0123456789ABAT\n";
+
+int main(int argc, char **argv)
+{
+        size_t n;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        prepare_input(test_case_1, sizeof(test_case_1) - 1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n> \nOK\n\nOK\n") == 0);
+        assert(data_results_size == 10);
+        assert(memcmp(data_results, "0\n2AT\r\0+78", 10) == 0);
+        assert(data_cntr == 3);
+
+        prepare_input(test_case_2, sizeof(test_case_2) - 1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n> \nOK\n\nERROR\n\nOK\n") == 0);
+        assert(memcmp(recv_buf, "ab\ncd", 5) == 0);
+        assert(data_cntr == 0);
+
+        prepare_input(test_case_3, sizeof(test_case_3) - 1);
+        data_fail = true;
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n> \nERROR\n\nOK\n") == 0);
+        assert(data_cntr == 1);
+
+        prepare_input("", 0);
+        feed_begin = test_case_4;
+        feed_end = test_case_4 + sizeof(test_case_4) - 1;
+        assert(cat_feed(&at, test_case_4, 15, &n, 1000, NULL) == CAT_STATUS_OK);
+        assert(n == 15);
+        assert(strcmp(ack_results, "\n> ") == 0);
+        assert(data_results_size == 3);
+        assert(cat_feed(&at, test_case_4 + 15, sizeof(test_case_4) - 1 - 15, &n, 1000, NULL) == CAT_STATUS_OK);
+        assert(n == sizeof(test_case_4) - 1 - 15);
+        assert(strcmp(ack_results, "\n> \nOK\n\nOK\n") == 0);
+        assert(data_results_size == 12);
+        assert(memcmp(data_results, "0123456789AB", 12) == 0);
+        assert(data_cntr == 2);
+
+        return 0;
+}
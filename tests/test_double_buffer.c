@@ -0,0 +1,207 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char run_results[256];
+static char ack_results[256];
+
+static char const *input_text;
+static size_t input_index;
+
+static bool write_ready;
+
+static cat_return_state cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        strcat(run_results, " W_");
+        strcat(run_results, cmd->name);
+        strcat(run_results, ":");
+        strncat(run_results, (const char *)data, data_size);
+        return CAT_RETURN_STATE_OK;
+}
+
+static cat_return_state cmd_read(const struct cat_command *cmd, uint8_t *data, size_t *data_size, const size_t max_data_size)
+{
+        strcat(run_results, " R_");
+        strcat(run_results, cmd->name);
+
+        strcpy((char *)data, "+GET=abc");
+        *data_size = strlen((char *)data);
+        return CAT_RETURN_STATE_DATA_OK;
+}
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+SET",
+                .write = cmd_write
+        },
+        {
+                .name = "+GET",
+                .read = cmd_read
+        },
+};
+
+static char buf[128];
+static char buf2[64];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+
+        .atcmd_buf2 = buf2,
+        .atcmd_buf2_size = sizeof(buf2)
+};
+
+static struct cat_descriptor desc_single = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf)
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+
+        if (write_ready == false)
+                return 0;
+
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(run_results, 0, sizeof(run_results));
+        memset(ack_results, 0, sizeof(ack_results));
+}
+
+static void run(struct cat_object *at)
+{
+        int i;
+
+        for (i = 0; i < 1000; i++)
+                cat_service(at);
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+        cat_stop_reason reason;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        write_ready = false;
+        prepare_input("AT+GET?\nAT+SET=12\n");
+        run(&at);
+        assert(input_index == strlen(input_text));
+        assert(strcmp(run_results, " R_+GET") == 0);
+        assert(strcmp(ack_results, "") == 0);
+        assert(cat_is_busy(&at) == CAT_STATUS_BUSY);
+        assert(cat_get_wait_reason(&at, &reason) == CAT_STATUS_OK);
+        assert(reason == CAT_STOP_REASON_OUTPUT_BLOCKED);
+
+        write_ready = true;
+        while (cat_service(&at) != 0) {};
+        assert(strcmp(run_results, " R_+GET W_+SET:12") == 0);
+        assert(strcmp(ack_results, "\n+GET=abc\n\nOK\n\nOK\n") == 0);
+
+        write_ready = false;
+        prepare_input("AT+GET?\r\nAT+XYZ\nAT+SET=3\n");
+        run(&at);
+        assert(input_index == strlen("AT+GET?\r\nAT+XYZ\n"));
+        assert(strcmp(ack_results, "") == 0);
+
+        write_ready = true;
+        while (cat_service(&at) != 0) {};
+        assert(strcmp(run_results, " R_+GET W_+SET:3") == 0);
+        assert(strcmp(ack_results, "\r\n+GET=abc\r\n\r\nOK\r\n\nERROR\n\nOK\n") == 0);
+
+        write_ready = false;
+        prepare_input("AT+GET?\nXX\nAT+SET=5\n");
+        run(&at);
+        assert(input_index == strlen("AT+GET?\nXX\n"));
+        assert(strcmp(ack_results, "") == 0);
+
+        write_ready = true;
+        while (cat_service(&at) != 0) {};
+        assert(strcmp(run_results, " R_+GET W_+SET:5") == 0);
+        assert(strcmp(ack_results, "\n+GET=abc\n\nOK\n\nERROR\n\nOK\n") == 0);
+
+        cat_init(&at, &desc_single, &iface, NULL);
+
+        write_ready = false;
+        prepare_input("AT+GET?\nAT+SET=12\n");
+        run(&at);
+        assert(input_index == strlen("AT+GET?\n"));
+        assert(strcmp(run_results, " R_+GET") == 0);
+
+        write_ready = true;
+        while (cat_service(&at) != 0) {};
+        assert(strcmp(run_results, " R_+GET W_+SET:12") == 0);
+        assert(strcmp(ack_results, "\n+GET=abc\n\nOK\n\nOK\n") == 0);
+
+        return 0;
+}
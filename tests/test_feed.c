@@ -0,0 +1,202 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char run_results[256];
+static char ack_results[256];
+
+static bool write_ready;
+static bool loop_done;
+
+static cat_return_state cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        strcat(run_results, " W_");
+        strcat(run_results, cmd->name);
+        strcat(run_results, ":");
+        strncat(run_results, (const char *)data, data_size);
+        return CAT_RETURN_STATE_OK;
+}
+
+static cat_return_state cmd_run(const struct cat_command *cmd)
+{
+        strcat(run_results, " R_");
+        strcat(run_results, cmd->name);
+        return CAT_RETURN_STATE_OK;
+}
+
+static cat_return_state cmd_hold(const struct cat_command *cmd)
+{
+        strcat(run_results, " H_");
+        strcat(run_results, cmd->name);
+        return CAT_RETURN_STATE_HOLD;
+}
+
+static cat_return_state cmd_loop(const struct cat_command *cmd)
+{
+        return (loop_done != false) ? CAT_RETURN_STATE_OK : CAT_RETURN_STATE_NEXT;
+}
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+SET",
+                .write = cmd_write,
+                .run = cmd_run
+        },
+        {
+                .name = "+WAIT",
+                .run = cmd_hold
+        },
+        {
+                .name = "+LOOP",
+                .run = cmd_loop
+        },
+};
+
+static char buf[128];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf)
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+
+        if (write_ready == false)
+                return 0;
+
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = NULL,
+        .write = write_char
+};
+
+static void prepare_results(void)
+{
+        memset(run_results, 0, sizeof(run_results));
+        memset(ack_results, 0, sizeof(ack_results));
+}
+
+static size_t feed_text(struct cat_object *at, const char *text)
+{
+        cat_stop_reason reason;
+        size_t n;
+
+        assert(cat_feed(at, (const uint8_t *)text, strlen(text), &n, 1000, &reason) >= CAT_STATUS_OK);
+        assert(reason != CAT_STOP_REASON_BUDGET);
+        return n;
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+        cat_stop_reason reason;
+        size_t n;
+        static const char text_1[] = "\nAT+SET=1\nAT+SET\nAT\n";
+        static const char text_2[] = "AT+SET=22\nAT+WAIT\nAT+SET=3\n";
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        write_ready = true;
+
+        prepare_results();
+        assert(feed_text(&at, text_1) == strlen(text_1));
+        assert(cat_is_busy(&at) == CAT_STATUS_OK);
+        assert(strcmp(ack_results, "\nOK\n\nOK\n\nOK\n") == 0);
+        assert(strcmp(run_results, " W_+SET:1 R_+SET") == 0);
+
+        prepare_results();
+        assert(feed_text(&at, "AT+S") == 4);
+        assert(cat_is_busy(&at) != CAT_STATUS_OK);
+        assert(feed_text(&at, "ET=") == 3);
+        assert(feed_text(&at, "5\n") == 2);
+        assert(strcmp(ack_results, "\nOK\n") == 0);
+        assert(strcmp(run_results, " W_+SET:5") == 0);
+
+        prepare_results();
+        assert(feed_text(&at, text_2) == strlen("AT+SET=22\nAT+WAIT\n"));
+        assert(cat_is_hold(&at) == CAT_STATUS_HOLD);
+        assert(feed_text(&at, "AT+SET=3\n") == 0);
+        assert(strcmp(run_results, " W_+SET:22 H_+WAIT") == 0);
+
+        assert(cat_hold_exit(&at, CAT_STATUS_OK) == CAT_STATUS_OK);
+        assert(feed_text(&at, "AT+SET=3\n") == strlen("AT+SET=3\n"));
+        assert(strcmp(ack_results, "\nOK\n\nOK\n\nOK\n") == 0);
+        assert(strcmp(run_results, " W_+SET:22 H_+WAIT W_+SET:3") == 0);
+
+        prepare_results();
+        write_ready = false;
+        assert(feed_text(&at, "AT+SET\nAT+SET=4\n") == strlen("AT+SET\n"));
+        assert(strcmp(ack_results, "") == 0);
+        assert(strcmp(run_results, " R_+SET") == 0);
+
+        write_ready = true;
+        assert(feed_text(&at, "AT+SET=4\n") == strlen("AT+SET=4\n"));
+        assert(strcmp(ack_results, "\nOK\n\nOK\n") == 0);
+        assert(strcmp(run_results, " R_+SET W_+SET:4") == 0);
+
+        while (cat_service(&at) != 0) {};
+        assert(cat_is_busy(&at) == CAT_STATUS_OK);
+
+        prepare_results();
+        assert(cat_feed(&at, (const uint8_t *)"AT+LOOP\n", 8, &n, 100, &reason) == CAT_STATUS_BUSY);
+        assert(n == 8);
+        assert(reason == CAT_STOP_REASON_BUDGET);
+        assert(cat_is_busy(&at) != CAT_STATUS_OK);
+        assert(strcmp(ack_results, "") == 0);
+
+        loop_done = true;
+        assert(feed_text(&at, "") == 0);
+        assert(strcmp(ack_results, "\nOK\n") == 0);
+        assert(cat_is_busy(&at) == CAT_STATUS_OK);
+
+        return 0;
+}
@@ -0,0 +1,204 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char ack_results[512];
+
+static int64_t var_int;
+static uint64_t var_uint;
+static uint64_t var_hex;
+
+static char const *input_text;
+static size_t input_index;
+
+static cat_return_state ext_read(const struct cat_command *cmd, uint8_t *data, size_t *data_size, const size_t max_data_size)
+{
+        if (cat_append_int(data, data_size, max_data_size, var_int) != 0)
+                return CAT_RETURN_STATE_ERROR;
+        data[(*data_size)++] = ',';
+        if (cat_append_uint(data, data_size, max_data_size, var_uint) != 0)
+                return CAT_RETURN_STATE_ERROR;
+        data[(*data_size)++] = ',';
+        if (cat_append_hex(data, data_size, max_data_size, var_hex, 3) != 0)
+                return CAT_RETURN_STATE_ERROR;
+        return CAT_RETURN_STATE_DATA_OK;
+}
+
+static struct cat_variable vars[] = {
+        {
+                .type = CAT_VAR_INT_DEC,
+                .data = &var_int,
+                .data_size = sizeof(var_int)
+        },
+        {
+                .type = CAT_VAR_UINT_DEC,
+                .data = &var_uint,
+                .data_size = sizeof(var_uint)
+        },
+        {
+                .type = CAT_VAR_NUM_HEX,
+                .data = &var_hex,
+                .data_size = sizeof(var_hex)
+        }
+};
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+SET",
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0])
+        },
+        {
+                .name = "+EXT",
+                .read = ext_read
+        }
+};
+
+static char buf[256];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(ack_results, 0, sizeof(ack_results));
+}
+
+static const char test_case_1[] = "\nAT+SET=-9223372036854775808,18446744073709551615,0xFEDCBA9876543210\nAT+SET?\n";
+static const char test_case_2[] = "\nAT+SET=-9223372036854775809,0,0x0\nAT+SET=9223372036854775808,0,0x0\nAT+SET=0,18446744073709551616,0x0\nAT+SET=0,0,0x10000000000000000\n";
+static const char test_case_3[] = "\nAT+SET=9223372036854775807,100,0x1\nAT+SET?\nAT+EXT?\n";
+static const char test_case_4[] = "\nAT+SET=?\n";
+
+static void test_append(void)
+{
+        uint8_t out[8];
+        size_t len = 0;
+
+        assert(cat_append_int(out, &len, sizeof(out), -12) == 0);
+        assert(len == 3);
+        assert(cat_append_uint(out, &len, sizeof(out), 9999) == 0);
+        assert(len == 7);
+        assert(strcmp((char*)out, "-129999") == 0);
+
+        assert(cat_append_uint(out, &len, sizeof(out), 0) != 0);
+        assert(len == 7);
+        assert(strcmp((char*)out, "-129999") == 0);
+
+        len = 0;
+        assert(cat_append_hex(out, &len, sizeof(out), 0xABCD, 2) == 0);
+        assert(strcmp((char*)out, "0xABCD") == 0);
+        assert(cat_append_hex(out, &len, sizeof(out), 0, 1) != 0);
+        assert(cat_append_hex(out, &len, sizeof(out), 0, 0) != 0);
+
+        len = 0;
+        assert(cat_append_uint(out, &len, sizeof(out), 0) == 0);
+        assert(cat_append_int(out, &len, sizeof(out), 7) == 0);
+        assert(cat_append_int(out, &len, sizeof(out), -100) == 0);
+        assert(strcmp((char*)out, "07-100") == 0);
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+
+        test_append();
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        prepare_input(test_case_1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\n+SET=-9223372036854775808,18446744073709551615,0xFEDCBA9876543210\n\nOK\n") == 0);
+        assert(var_int == INT64_MIN);
+        assert(var_uint == UINT64_MAX);
+        assert(var_hex == 0xFEDCBA9876543210ULL);
+
+        prepare_input(test_case_2);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nERROR\n\nERROR\n\nERROR\n\nERROR\n") == 0);
+
+        prepare_input(test_case_3);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\n+SET=9223372036854775807,100,0x0000000000000001\n\nOK\n\n+EXT=9223372036854775807,100,0x000001\n\nOK\n") == 0);
+        assert(var_int == INT64_MAX);
+
+        prepare_input(test_case_4);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n+SET=<INT64[RW]>,<UINT64[RW]>,<HEX64[RW]>\n\nOK\n") == 0);
+
+        return 0;
+}
@@ -151,6 +151,7 @@ static const char test_case_1[] = "\nAT\nAT+test\n";
 int main(int argc, char **argv)
 {
         struct cat_object at;
+        size_t n;
 
         cat_init(&at, &desc, &iface, &mutex);
 
@@ -176,6 +177,17 @@ int main(int argc, char **argv)
         mutex_ret_unlock = 1;
         assert(cat_is_busy(&at) == CAT_STATUS_ERROR_MUTEX_UNLOCK);
 
+        mutex_ret_lock = 1;
+        mutex_ret_unlock = 0;
+        assert(cat_feed(&at, (const uint8_t *)"AT\n", 3, &n, 100, NULL) == CAT_STATUS_ERROR_MUTEX_LOCK);
+        assert(n == 0);
+        assert(cat_service_run(&at, 100, NULL) == CAT_STATUS_ERROR_MUTEX_LOCK);
+
+        mutex_ret_lock = 0;
+        mutex_ret_unlock = 1;
+        assert(cat_feed(&at, (const uint8_t *)"", 0, &n, 100, NULL) == CAT_STATUS_ERROR_MUTEX_UNLOCK);
+        assert(cat_service_run(&at, 100, NULL) == CAT_STATUS_ERROR_MUTEX_UNLOCK);
+
         mutex_ret_lock = 0;
         mutex_ret_unlock = 0;
         assert(cat_service(&at) == CAT_STATUS_OK);
@@ -0,0 +1,159 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char ack_results[512];
+
+static char var_apn[48];
+static char var_full[20];
+
+static char const *input_text;
+static size_t input_index;
+
+static struct cat_variable apn_vars[] = {
+        {
+                .type = CAT_VAR_BUF_STRING,
+                .data = var_apn,
+                .data_size = sizeof(var_apn)
+        }
+};
+
+static struct cat_variable full_vars[] = {
+        {
+                .type = CAT_VAR_BUF_STRING,
+                .data = var_full,
+                .data_size = sizeof(var_full)
+        }
+};
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+APN",
+                .var = apn_vars,
+                .var_num = sizeof(apn_vars) / sizeof(apn_vars[0])
+        },
+        {
+                .name = "+FULL",
+                .var = full_vars,
+                .var_num = sizeof(full_vars) / sizeof(full_vars[0])
+        }
+};
+
+static char buf[128];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(ack_results, 0, sizeof(ack_results));
+}
+
+static const char test_case_1[] = "\nAT+APN?\nAT+FULL?\n";
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        /* escapes placed behind first 16 chars block, full variable without terminator */
+        strcpy(var_apn, "internet.provider.com\"x\\y\nz");
+        memcpy(var_full, "0123456789abcdef\"XYZ", sizeof(var_full));
+
+        prepare_input(test_case_1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n+APN=\"internet.provider.com\\\"x\\\\y\\nz\"\n\nOK\n\n+FULL=\"0123456789abcdef\\\"XYZ\"\n\nOK\n") == 0);
+
+        /* escaped string does not fit into half of working buffer */
+        memset(var_apn, '\\', sizeof(var_apn) - 1);
+        var_apn[sizeof(var_apn) - 1] = 0;
+
+        prepare_input(test_case_1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nERROR\n\n+FULL=\"0123456789abcdef\\\"XYZ\"\n\nOK\n") == 0);
+
+        /* value filling whole variable without terminator */
+        memset(var_apn, 'a', sizeof(var_apn));
+        var_full[0] = 0;
+
+        prepare_input(test_case_1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n+APN=\"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\"\n\nOK\n\n+FULL=\"\"\n\nOK\n") == 0);
+
+        return 0;
+}
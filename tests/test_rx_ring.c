@@ -0,0 +1,149 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char ack_results[256];
+static char set_results[64];
+
+static uint8_t rx_buf[8];
+static struct cat_rx_ring rx_ring;
+
+CAT_RX_RING_IO_READ(rx_read, rx_ring)
+
+static int cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        strncat(set_results, (const char *)data, data_size);
+        return 0;
+}
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+SET",
+                .write = cmd_write
+        },
+};
+
+static char buf[128];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf)
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = rx_read,
+        .write = write_char
+};
+
+static void feed_all(struct cat_object *at, const char *text)
+{
+        size_t len = strlen(text);
+        size_t n;
+
+        while (len > 0) {
+                n = sizeof(rx_buf) - 1 - cat_rx_ring_available(&rx_ring);
+                if (n > len)
+                        n = len;
+                assert(cat_rx_ring_write(&rx_ring, (const uint8_t *)text, n) == n);
+                text += n;
+                len -= n;
+                while (cat_service(at) != 0) {};
+        }
+        while (cat_service(at) != 0) {};
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+        uint8_t data[16];
+        char ch;
+
+        cat_rx_ring_init(&rx_ring, rx_buf, sizeof(rx_buf));
+        assert(cat_rx_ring_available(&rx_ring) == 0);
+        assert(cat_rx_ring_read_char(&rx_ring, &ch) == 0);
+
+        assert(cat_rx_ring_write(&rx_ring, (const uint8_t *)"abcde", 5) == 5);
+        assert(cat_rx_ring_available(&rx_ring) == 5);
+        assert(cat_rx_ring_read(&rx_ring, data, 3) == 3);
+        assert(memcmp(data, "abc", 3) == 0);
+
+        assert(cat_rx_ring_write(&rx_ring, (const uint8_t *)"fghijklm", 8) == 5);
+        assert(cat_rx_ring_overruns(&rx_ring) == 3);
+        assert(cat_rx_ring_received(&rx_ring) == 10);
+        assert(cat_rx_ring_available(&rx_ring) == 7);
+
+        assert(cat_rx_ring_read_char(&rx_ring, &ch) == 1);
+        assert(ch == 'd');
+        assert(cat_rx_ring_read(&rx_ring, data, sizeof(data)) == 6);
+        assert(memcmp(data, "efghij", 6) == 0);
+        assert(cat_rx_ring_available(&rx_ring) == 0);
+        assert(cat_rx_ring_read(&rx_ring, data, sizeof(data)) == 0);
+        assert(cat_rx_ring_write(&rx_ring, NULL, 0) == 0);
+
+        cat_rx_ring_init(&rx_ring, rx_buf, sizeof(rx_buf));
+        assert(cat_rx_ring_overruns(&rx_ring) == 0);
+        assert(cat_rx_ring_received(&rx_ring) == 0);
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        memset(ack_results, 0, sizeof(ack_results));
+        memset(set_results, 0, sizeof(set_results));
+        feed_all(&at, "\nAT+SET=0123456789abcdef\nAT\n");
+        assert(strcmp(set_results, "0123456789abcdef") == 0);
+        assert(strcmp(ack_results, "\nOK\n\nOK\n") == 0);
+        assert(cat_rx_ring_overruns(&rx_ring) == 0);
+        assert(cat_rx_ring_available(&rx_ring) == 0);
+
+        return 0;
+}
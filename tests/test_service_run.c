@@ -0,0 +1,177 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char run_results[256];
+static char ack_results[256];
+
+static char input_text[256];
+static size_t input_index;
+
+static bool write_ready;
+
+static cat_return_state cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        strcat(run_results, " W_");
+        strcat(run_results, cmd->name);
+        strcat(run_results, ":");
+        strncat(run_results, (const char *)data, data_size);
+        return CAT_RETURN_STATE_OK;
+}
+
+static cat_return_state cmd_hold(const struct cat_command *cmd)
+{
+        strcat(run_results, " H_");
+        strcat(run_results, cmd->name);
+        return CAT_RETURN_STATE_HOLD;
+}
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+SET",
+                .write = cmd_write
+        },
+        {
+                .name = "+WAIT",
+                .run = cmd_hold
+        },
+};
+
+static char buf[128];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf)
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+
+        if (write_ready == false)
+                return 0;
+
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_results(void)
+{
+        memset(run_results, 0, sizeof(run_results));
+        memset(ack_results, 0, sizeof(ack_results));
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+        cat_stop_reason reason;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        write_ready = true;
+
+        prepare_results();
+        strcpy(input_text, "\nAT+SET=1\nAT+S");
+        assert(cat_service_run(&at, 1000, &reason) == CAT_STATUS_OK);
+        assert(reason == CAT_STOP_REASON_NEED_INPUT);
+        assert(input_index == strlen(input_text));
+        assert(strcmp(ack_results, "\nOK\n") == 0);
+        assert(strcmp(run_results, " W_+SET:1") == 0);
+
+        strcat(input_text, "ET=2\n");
+        assert(cat_service_run(&at, 1000, &reason) == CAT_STATUS_OK);
+        assert(reason == CAT_STOP_REASON_IDLE);
+        assert(strcmp(ack_results, "\nOK\n\nOK\n") == 0);
+        assert(strcmp(run_results, " W_+SET:1 W_+SET:2") == 0);
+
+        prepare_results();
+        strcat(input_text, "AT+SET=3\n");
+        assert(cat_service_run(&at, 2, &reason) == CAT_STATUS_BUSY);
+        assert(reason == CAT_STOP_REASON_BUDGET);
+        assert(strcmp(run_results, "") == 0);
+        assert(cat_service_run(&at, 0, &reason) == CAT_STATUS_OK);
+        assert(reason == CAT_STOP_REASON_BUDGET);
+        assert(cat_service_run(&at, 1000, NULL) == CAT_STATUS_OK);
+        assert(strcmp(ack_results, "\nOK\n") == 0);
+        assert(strcmp(run_results, " W_+SET:3") == 0);
+
+        prepare_results();
+        strcat(input_text, "AT+WAIT\nAT+SET=4\n");
+        assert(cat_service_run(&at, 1000, &reason) == CAT_STATUS_BUSY);
+        assert(reason == CAT_STOP_REASON_HOLD);
+        assert(cat_is_hold(&at) == CAT_STATUS_HOLD);
+        assert(strcmp(run_results, " H_+WAIT") == 0);
+
+        assert(cat_hold_exit(&at, CAT_STATUS_OK) == CAT_STATUS_OK);
+        write_ready = false;
+        assert(cat_service_run(&at, 1000, &reason) == CAT_STATUS_BUSY);
+        assert(reason == CAT_STOP_REASON_OUTPUT_BLOCKED);
+        assert(strcmp(ack_results, "") == 0);
+
+        write_ready = true;
+        assert(cat_service_run(&at, 1000, &reason) == CAT_STATUS_OK);
+        assert(reason == CAT_STOP_REASON_IDLE);
+        assert(strcmp(ack_results, "\nOK\n\nOK\n") == 0);
+        assert(strcmp(run_results, " H_+WAIT W_+SET:4") == 0);
+
+        return 0;
+}
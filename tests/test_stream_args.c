@@ -0,0 +1,216 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char write_results[256];
+static char ack_results[256];
+
+static uint8_t id;
+static uint8_t chunk[8];
+static uint8_t payload[1024];
+static size_t payload_size;
+static int chunk_cntr;
+static size_t chunk_end;
+static char msg[16];
+static size_t var_write_size[4];
+static int var_write_size_index;
+
+static char input_text[4096];
+static size_t input_index;
+
+static int cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        sprintf(write_results + strlen(write_results), " CMD:%d:%d", (int)data_size, (int)args_num);
+        return 0;
+}
+
+static int var_write(const struct cat_variable *var, size_t write_size)
+{
+        var_write_size[var_write_size_index++] = write_size;
+        return 0;
+}
+
+static int var_chunk(const struct cat_variable *var, const size_t offset, const size_t size)
+{
+        assert((offset == 0) || (offset == chunk_end));
+        assert(size > 0);
+        assert(size <= var->data_size);
+        assert(payload_size + size <= sizeof(payload));
+
+        memcpy(&payload[payload_size], var->data, size);
+        chunk_end = offset + size;
+        payload_size += size;
+        chunk_cntr++;
+        return 0;
+}
+
+static struct cat_variable vars[] = {
+        {
+                .name = "ID",
+                .type = CAT_VAR_UINT_DEC,
+                .data = &id,
+                .data_size = sizeof(id),
+                .write = var_write
+        },
+        {
+                .name = "DATA",
+                .type = CAT_VAR_BUF_HEX,
+                .data = chunk,
+                .data_size = sizeof(chunk),
+                .write = var_write,
+                .chunk = var_chunk
+        },
+        {
+                .name = "MSG",
+                .type = CAT_VAR_BUF_STRING,
+                .data = msg,
+                .data_size = sizeof(msg),
+                .write = var_write
+        }
+};
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+SEND",
+                .write = cmd_write,
+
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0]),
+                .stream_args = true
+        }
+};
+
+static char buf[16];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf)
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        strcpy(input_text, text);
+        input_index = 0;
+
+        id = 0;
+        memset(msg, 0, sizeof(msg));
+        memset(payload, 0, sizeof(payload));
+        payload_size = 0;
+        chunk_cntr = 0;
+        chunk_end = 0;
+        memset(var_write_size, 0, sizeof(var_write_size));
+        var_write_size_index = 0;
+
+        memset(ack_results, 0, sizeof(ack_results));
+        memset(write_results, 0, sizeof(write_results));
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+        char *p;
+        size_t i;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        prepare_input("");
+        strcpy(input_text, "\nAT+SEND=7,");
+        p = input_text + strlen(input_text);
+        for (i = 0; i < sizeof(payload); i++)
+                p += sprintf(p, "%02X", (unsigned)(i & 0xFF) ^ 0x5A);
+        strcpy(p, ",\"hello world\"\n");
+
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n") == 0);
+        assert(strcmp(write_results, " CMD:0:3") == 0);
+        assert(id == 7);
+        assert(payload_size == sizeof(payload));
+        assert(chunk_cntr == sizeof(payload) / sizeof(chunk));
+        for (i = 0; i < sizeof(payload); i++)
+                assert(payload[i] == ((i & 0xFF) ^ 0x5A));
+        assert(strcmp(msg, "hello world") == 0);
+        assert(var_write_size_index == 3);
+        assert(var_write_size[0] == 1);
+        assert(var_write_size[1] == sizeof(payload));
+        assert(var_write_size[2] == 11);
+
+        prepare_input("\nAT+SEND=1,ABC\nAT+SEND=2,0102030405\nAT+SEND=0000000000000000000001,01\nAT+SEND=3,01,\"x\",4\nAT+SEND=4,01,\"x\"\r\n");
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nERROR\n\nOK\n\nERROR\n\nERROR\n\r\nOK\r\n") == 0);
+        assert(strcmp(write_results, " CMD:0:2 CMD:0:3") == 0);
+        assert(chunk_cntr == 3);
+        assert(payload_size == 7);
+        assert(memcmp(payload, "\x01\x02\x03\x04\x05\x01\x01", 7) == 0);
+        assert(id == 4);
+        assert(strcmp(msg, "x") == 0);
+
+        return 0;
+}
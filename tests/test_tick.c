@@ -0,0 +1,217 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char run_results[256];
+static char ack_results[256];
+
+static char input_text[256];
+static size_t input_index;
+
+static int notify_cntr;
+
+static cat_return_state cmd_run(const struct cat_command *cmd)
+{
+        strcat(run_results, " R_");
+        strcat(run_results, cmd->name);
+        return CAT_RETURN_STATE_OK;
+}
+
+static cat_return_state cmd_hold(const struct cat_command *cmd)
+{
+        strcat(run_results, " H_");
+        strcat(run_results, cmd->name);
+        return CAT_RETURN_STATE_HOLD;
+}
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+SET",
+                .run = cmd_run
+        },
+        {
+                .name = "+WAIT",
+                .run = cmd_hold,
+                .hold_timeout_ms = 100
+        },
+        {
+                .name = "+LONG",
+                .run = cmd_hold
+        },
+};
+
+static char buf[128];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+
+        .hold_timeout_ms = 500,
+        .char_timeout_ms = 50
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static void notify(void)
+{
+        notify_cntr++;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text[0] = 0;
+        strcat(input_text, text);
+        input_index = 0;
+
+        memset(run_results, 0, sizeof(run_results));
+        memset(ack_results, 0, sizeof(ack_results));
+        notify_cntr = 0;
+}
+
+static void run(struct cat_object *at)
+{
+        int i;
+
+        for (i = 0; i < 1000; i++)
+                cat_service(at);
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+
+        cat_init(&at, &desc, &iface, NULL);
+        cat_set_notify_handler(&at, notify);
+
+        assert(cat_tick(&at, 0) == CAT_STATUS_OK);
+
+        prepare_input("AT+WAIT\n");
+        run(&at);
+        assert(cat_is_hold(&at) == CAT_STATUS_HOLD);
+        assert(cat_tick(&at, 99) == CAT_STATUS_OK);
+        run(&at);
+        assert(cat_is_hold(&at) == CAT_STATUS_HOLD);
+        assert(notify_cntr == 0);
+        assert(cat_tick(&at, 100) == CAT_STATUS_OK);
+        assert(notify_cntr == 1);
+        run(&at);
+        assert(cat_is_hold(&at) == CAT_STATUS_OK);
+        assert(strcmp(run_results, " H_+WAIT") == 0);
+        assert(strcmp(ack_results, "\nERROR\n") == 0);
+
+        prepare_input("AT+LONG\n");
+        run(&at);
+        assert(cat_tick(&at, 599) == CAT_STATUS_OK);
+        run(&at);
+        assert(cat_is_hold(&at) == CAT_STATUS_HOLD);
+        assert(cat_hold_exit(&at, CAT_STATUS_OK) == CAT_STATUS_OK);
+        assert(cat_tick(&at, 600) == CAT_STATUS_OK);
+        run(&at);
+        assert(strcmp(ack_results, "\nOK\n") == 0);
+
+        prepare_input("AT+LONG\n");
+        run(&at);
+        assert(cat_tick(&at, 1099) == CAT_STATUS_OK);
+        run(&at);
+        assert(cat_is_hold(&at) == CAT_STATUS_HOLD);
+        assert(cat_tick(&at, 1100) == CAT_STATUS_OK);
+        run(&at);
+        assert(cat_is_hold(&at) == CAT_STATUS_OK);
+        assert(strcmp(ack_results, "\nERROR\n") == 0);
+
+        prepare_input("AT+SE");
+        run(&at);
+        assert(cat_tick(&at, 1149) == CAT_STATUS_OK);
+        run(&at);
+        assert(strcmp(ack_results, "") == 0);
+        assert(notify_cntr == 0);
+        assert(cat_tick(&at, 1150) == CAT_STATUS_OK);
+        assert(notify_cntr == 1);
+        run(&at);
+        assert(strcmp(ack_results, "\nERROR\n") == 0);
+        assert(strcmp(run_results, "") == 0);
+
+        prepare_input("AT+SET\n");
+        assert(cat_tick(&at, 5000) == CAT_STATUS_OK);
+        assert(notify_cntr == 0);
+        run(&at);
+        assert(strcmp(ack_results, "\nOK\n") == 0);
+        assert(strcmp(run_results, " R_+SET") == 0);
+
+        assert(cat_tick(&at, 0xFFFFFFF0UL) == CAT_STATUS_OK);
+        prepare_input("AT+WAIT\n");
+        run(&at);
+        assert(cat_tick(&at, 0x00000050UL) == CAT_STATUS_OK);
+        run(&at);
+        assert(cat_is_hold(&at) == CAT_STATUS_HOLD);
+        assert(cat_tick(&at, 0x00000060UL) == CAT_STATUS_OK);
+        run(&at);
+        assert(cat_is_hold(&at) == CAT_STATUS_OK);
+        assert(strcmp(ack_results, "\nERROR\n") == 0);
+
+        return 0;
+}
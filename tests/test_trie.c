@@ -0,0 +1,198 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char run_results[256];
+static char ack_results[256];
+
+static char const *input_text;
+static size_t input_index;
+
+static cat_return_state cmd_run(const struct cat_command *cmd)
+{
+        strcat(run_results, " R_");
+        strcat(run_results, cmd->name);
+        return CAT_RETURN_STATE_OK;
+}
+
+static cat_return_state cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        strcat(run_results, " W_");
+        strcat(run_results, cmd->name);
+        strcat(run_results, ":");
+        strncat(run_results, (const char *)data, data_size);
+        return CAT_RETURN_STATE_OK;
+}
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+TEST_B",
+                .run = cmd_run
+        },
+        {
+                .name = "+TEST",
+                .run = cmd_run
+        },
+        {
+                .name = "+test_a",
+                .run = cmd_run
+        },
+        {
+                .name = "+ONE",
+                .run = cmd_run
+        },
+        {
+                .name = "+TWO",
+                .run = cmd_run
+        },
+};
+
+static struct cat_command cmds_ext[] = {
+        {
+                .name = "DTEST",
+                .run = cmd_run,
+                .write = cmd_write
+        },
+        {
+                .name = "D",
+                .write = cmd_write,
+                .implicit_write = true
+        },
+        {
+                .name = "+ONE",
+                .run = cmd_run
+        },
+};
+
+static char buf[16];
+static struct cat_trie_node trie[64];
+static uint16_t trie_order[8];
+
+static struct cat_command_group cmd_group = {
+        .name = "std",
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group cmd_group_ext = {
+        .name = "ext",
+        .cmd = cmds_ext,
+        .cmd_num = sizeof(cmds_ext) / sizeof(cmds_ext[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group,
+        &cmd_group_ext
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+
+        .trie = trie,
+        .trie_size = sizeof(trie) / sizeof(trie[0]),
+        .trie_order = trie_order
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(run_results, 0, sizeof(run_results));
+        memset(ack_results, 0, sizeof(ack_results));
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        prepare_input("\nAT+T\nAT+TEST\nAT+TEST_\nAT+TEST_A\nat+test_b\nAT+TW\nAT+X\nAT+TESTX\n");
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nERROR\n\nOK\n\nERROR\n\nOK\n\nOK\n\nOK\n\nERROR\n\nERROR\n") == 0);
+        assert(strcmp(run_results, " R_+TEST R_+test_a R_+TEST_B R_+TWO") == 0);
+
+        prepare_input("\nATD\nATDTEST\nATD=1\nAT+ONE\nAT+O\n");
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\nOK\n\nOK\n\nOK\n\nERROR\n") == 0);
+        assert(strcmp(run_results, " W_D: W_D:TEST W_D:=1 R_+ONE") == 0);
+
+        cmds_ext[1].disable = true;
+        cmds[0].disable = true;
+
+        prepare_input("\nATDT\nATD\nAT+TEST_\nAT+TEST_B\n");
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\nOK\n\nOK\n\nERROR\n") == 0);
+        assert(strcmp(run_results, " R_DTEST R_DTEST R_+test_a") == 0);
+
+        cmd_group_ext.disable = true;
+
+        prepare_input("\nATD\nAT+O\nAT+ONE\n");
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nERROR\n\nOK\n\nOK\n") == 0);
+        assert(strcmp(run_results, " R_+ONE R_+ONE") == 0);
+
+        return 0;
+}
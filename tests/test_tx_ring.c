@@ -0,0 +1,186 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char ack_results[256];
+
+static char const *input_text;
+static size_t input_index;
+
+static const uint8_t *tx_data;
+static size_t tx_size;
+static int tx_starts;
+static int notify_cntr;
+
+static cat_return_state cmd_read(const struct cat_command *cmd, uint8_t *data, size_t *data_size, const size_t max_data_size)
+{
+        strcpy((char *)data, "+GET=0123456789");
+        *data_size = strlen((char *)data);
+        return CAT_RETURN_STATE_DATA_OK;
+}
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+GET",
+                .read = cmd_read
+        },
+};
+
+static char buf[128];
+static uint8_t tx_ring[16];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+
+        .tx_ring = tx_ring,
+        .tx_ring_size = sizeof(tx_ring)
+};
+
+static int write_char(char ch)
+{
+        assert(false);
+        return 0;
+}
+
+static int start_tx(const uint8_t *data, size_t len)
+{
+        assert(tx_data == NULL);
+        assert(len > 0);
+        assert(data >= tx_ring && data + len <= tx_ring + sizeof(tx_ring));
+
+        tx_data = data;
+        tx_size = len;
+        tx_starts++;
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static void notify(void)
+{
+        notify_cntr++;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char,
+        .start_tx = start_tx
+};
+
+static void complete_tx(struct cat_object *at, size_t n)
+{
+        const uint8_t *data = tx_data;
+
+        assert(tx_data != NULL);
+        assert(n <= tx_size);
+
+        tx_data = NULL;
+        strncat(ack_results, (const char *)data, n);
+        cat_tx_complete(at, n);
+}
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(ack_results, 0, sizeof(ack_results));
+        tx_starts = 0;
+        notify_cntr = 0;
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+        cat_stop_reason reason;
+        int i;
+
+        cat_init(&at, &desc, &iface, NULL);
+        cat_set_notify_handler(&at, notify);
+
+        prepare_input("AT\n");
+        while (cat_service(&at) != 0) {};
+        assert(tx_starts == 1);
+        assert(tx_size == 4);
+        assert(strcmp(ack_results, "") == 0);
+        assert(cat_is_busy(&at) == CAT_STATUS_OK);
+
+        complete_tx(&at, tx_size);
+        assert(notify_cntr == 1);
+        assert(strcmp(ack_results, "\nOK\n") == 0);
+        assert(cat_service(&at) == CAT_STATUS_OK);
+        assert(tx_data == NULL);
+
+        prepare_input("AT+GET?\n");
+        for (i = 0; i < 1000; i++)
+                cat_service(&at);
+        assert(cat_get_wait_reason(&at, &reason) == CAT_STATUS_OK);
+        assert(reason == CAT_STOP_REASON_OUTPUT_BLOCKED);
+        assert(tx_starts == 1);
+        assert(tx_size == 12);
+
+        complete_tx(&at, 5);
+        for (i = 0; i < 1000; i++) {
+                cat_service(&at);
+                if (tx_data != NULL)
+                        complete_tx(&at, tx_size);
+        }
+        assert(cat_is_busy(&at) == CAT_STATUS_OK);
+        assert(tx_data == NULL);
+        assert(tx_starts > 3);
+        assert(notify_cntr == tx_starts);
+        assert(strcmp(ack_results, "\n+GET=0123456789\n\nOK\n") == 0);
+
+        return 0;
+}
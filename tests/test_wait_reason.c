@@ -0,0 +1,201 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char run_results[256];
+static char ack_results[256];
+
+static char input_text[256];
+static size_t input_index;
+
+static bool write_ready;
+static int notify_cntr;
+
+static cat_return_state cmd_hold(const struct cat_command *cmd)
+{
+        strcat(run_results, " H_");
+        strcat(run_results, cmd->name);
+        return CAT_RETURN_STATE_HOLD;
+}
+
+static cat_return_state cmd_read(const struct cat_command *cmd, uint8_t *data, size_t *data_size, const size_t max_data_size)
+{
+        strcat(run_results, " R_");
+        strcat(run_results, cmd->name);
+        return CAT_RETURN_STATE_DATA_OK;
+}
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+WAIT",
+                .run = cmd_hold
+        },
+        {
+                .name = "+EVT",
+                .read = cmd_read
+        },
+};
+
+static char buf[128];
+static char unsolicited_buf[64];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+        .unsolicited_buf = unsolicited_buf,
+        .unsolicited_buf_size = sizeof(unsolicited_buf)
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+
+        if (write_ready == false)
+                return 0;
+
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static void notify(void)
+{
+        notify_cntr++;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_results(void)
+{
+        memset(run_results, 0, sizeof(run_results));
+        memset(ack_results, 0, sizeof(ack_results));
+        notify_cntr = 0;
+}
+
+static cat_stop_reason run_until_wait(struct cat_object *at)
+{
+        cat_stop_reason reason;
+        int i;
+
+        for (i = 0; i < 1000; i++) {
+                cat_service(at);
+                assert(cat_get_wait_reason(at, &reason) == CAT_STATUS_OK);
+                if (reason != CAT_STOP_REASON_NONE)
+                        break;
+        }
+        return reason;
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+        cat_stop_reason reason;
+
+        cat_init(&at, &desc, &iface, NULL);
+        assert(cat_set_notify_handler(&at, notify) == CAT_STATUS_OK);
+
+        assert(cat_get_wait_reason(&at, &reason) == CAT_STATUS_OK);
+        assert(reason == CAT_STOP_REASON_IDLE);
+
+        write_ready = true;
+
+        prepare_results();
+        assert(run_until_wait(&at) == CAT_STOP_REASON_IDLE);
+
+        strcpy(input_text, "AT+WA");
+        cat_input_available(&at);
+        assert(notify_cntr == 1);
+        assert(run_until_wait(&at) == CAT_STOP_REASON_NEED_INPUT);
+
+        strcat(input_text, "IT\n");
+        cat_input_available(&at);
+        assert(notify_cntr == 2);
+        assert(run_until_wait(&at) == CAT_STOP_REASON_HOLD);
+        assert(run_until_wait(&at) == CAT_STOP_REASON_HOLD);
+        assert(strcmp(run_results, " H_+WAIT") == 0);
+        assert(strcmp(ack_results, "") == 0);
+
+        write_ready = false;
+        assert(cat_hold_exit(&at, CAT_STATUS_OK) == CAT_STATUS_OK);
+        assert(notify_cntr == 3);
+        assert(run_until_wait(&at) == CAT_STOP_REASON_OUTPUT_BLOCKED);
+        assert(strcmp(ack_results, "") == 0);
+
+        write_ready = true;
+        cat_output_ready(&at);
+        assert(notify_cntr == 4);
+        assert(run_until_wait(&at) == CAT_STOP_REASON_IDLE);
+        assert(strcmp(ack_results, "\nOK\n") == 0);
+
+        prepare_results();
+        assert(cat_hold_exit(&at, CAT_STATUS_OK) == CAT_STATUS_ERROR_NOT_HOLD);
+        assert(notify_cntr == 0);
+
+        assert(cat_trigger_unsolicited_read(&at, &cmds[1]) == CAT_STATUS_OK);
+        assert(notify_cntr == 1);
+        assert(run_until_wait(&at) == CAT_STOP_REASON_IDLE);
+        assert(strcmp(run_results, " R_+EVT") == 0);
+        assert(strcmp(ack_results, "\n+EVT=\n") == 0);
+
+        assert(cat_set_notify_handler(&at, NULL) == CAT_STATUS_OK);
+        cat_input_available(&at);
+        assert(notify_cntr == 1);
+
+        return 0;
+}
@@ -0,0 +1,219 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char ack_results[256];
+
+static char const *input_text;
+static size_t input_index;
+
+static int lines_cntr;
+static int lines_num;
+static struct cat_object at;
+
+static struct cat_command urc_cmd;
+
+static cat_return_state cmd_read(const struct cat_command *cmd, uint8_t *data, size_t *data_size, const size_t max_data_size)
+{
+        lines_cntr++;
+        sprintf((char *)data, "+LIST=%d", lines_cntr);
+        *data_size = strlen((char *)data);
+
+        if ((lines_cntr == 1) && (lines_num > 1))
+                assert(cat_trigger_unsolicited_read(&at, &urc_cmd) == CAT_STATUS_OK);
+
+        return (lines_cntr < lines_num) ? CAT_RETURN_STATE_DATA_NEXT : CAT_RETURN_STATE_DATA_OK;
+}
+
+static cat_return_state urc_read(const struct cat_command *cmd, uint8_t *data, size_t *data_size, const size_t max_data_size)
+{
+        strcpy((char *)data, "+URC");
+        *data_size = strlen((char *)data);
+        return CAT_RETURN_STATE_DATA_OK;
+}
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+LIST",
+                .read = cmd_read
+        },
+};
+
+static struct cat_command urc_cmd = {
+        .name = "+URC",
+        .read = urc_read
+};
+
+static char buf[128];
+static char unsolicited_buf[64];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+        .unsolicited_buf = unsolicited_buf,
+        .unsolicited_buf_size = sizeof(unsolicited_buf)
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void run_list(uint8_t atcmd_priority, uint8_t unsolicited_priority)
+{
+        desc.atcmd_write_priority = atcmd_priority;
+        desc.unsolicited_write_priority = unsolicited_priority;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        input_text = "AT+LIST?\n";
+        input_index = 0;
+        lines_cntr = 0;
+        lines_num = 3;
+        memset(ack_results, 0, sizeof(ack_results));
+
+        while (cat_service(&at) != 0) {};
+}
+
+static bool run_tie(int trigger_step)
+{
+        int i;
+
+        desc.atcmd_write_priority = 0;
+        desc.unsolicited_write_priority = 0;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        input_text = "AT+LIST?\n";
+        input_index = 0;
+        lines_cntr = 0;
+        lines_num = 1;
+        memset(ack_results, 0, sizeof(ack_results));
+
+        for (i = 0; i < trigger_step; i++)
+                (void) cat_service(&at);
+        assert(cat_trigger_unsolicited_read(&at, &urc_cmd) == CAT_STATUS_OK);
+        while (cat_service(&at) != 0) {};
+
+        if (strcmp(ack_results, "\n+URC\n\n+LIST=1\n\nOK\n") == 0)
+                return true;
+
+        assert((strcmp(ack_results, "\n+LIST=1\n\n+URC\n\nOK\n") == 0) ||
+               (strcmp(ack_results, "\n+LIST=1\n\nOK\n\n+URC\n") == 0));
+        return false;
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_write_stats atcmd_stats, urc_stats, urc_stats_prio;
+        bool urc_first, prev_urc_first;
+        int step;
+
+        run_list(0, 0);
+        assert(strcmp(ack_results, "\n+LIST=1\n\n+URC\n\n+LIST=2\n\n+LIST=3\n\nOK\n") == 0);
+
+        assert(cat_get_write_stats(&at, CAT_FSM_TYPE_ATCMD, &atcmd_stats) == CAT_STATUS_OK);
+        assert(cat_get_write_stats(&at, CAT_FSM_TYPE_UNSOLICITED, &urc_stats) == CAT_STATUS_OK);
+        assert(atcmd_stats.writes == 4);
+        assert(urc_stats.writes == 1);
+        assert(urc_stats.max_wait_steps > 0);
+
+        run_list(1, 0);
+        assert(strcmp(ack_results, "\n+LIST=1\n\n+LIST=2\n\n+LIST=3\n\nOK\n\n+URC\n") == 0);
+
+        assert(cat_get_write_stats(&at, CAT_FSM_TYPE_UNSOLICITED, &urc_stats_prio) == CAT_STATUS_OK);
+        assert(urc_stats_prio.writes == 1);
+        assert(urc_stats_prio.max_wait_steps > urc_stats.max_wait_steps);
+
+        run_list(0, 1);
+        assert(strcmp(ack_results, "\n+URC\n\n+LIST=1\n\n+LIST=2\n\n+LIST=3\n\nOK\n") == 0);
+
+        assert(cat_get_write_stats(&at, CAT_FSM_TYPE_ATCMD, &atcmd_stats) == CAT_STATUS_OK);
+        assert(atcmd_stats.max_wait_steps > 1);
+
+        /* with equal priorities line which waits first is written first, so later triggered event cannot overtake */
+        prev_urc_first = true;
+        for (step = 0; step < 40; step++) {
+                urc_first = run_tie(step);
+                assert((urc_first == false) || (prev_urc_first != false));
+
+                assert(cat_get_write_stats(&at, CAT_FSM_TYPE_UNSOLICITED, &urc_stats) == CAT_STATUS_OK);
+                if (urc_first != false) {
+                        /* event ready before or in the same step as response line (tie) is written without waiting */
+                        assert(urc_stats.max_wait_steps == 1);
+                } else if (prev_urc_first != false) {
+                        /* event ready one step after response line waits until whole line is written */
+                        assert(urc_stats.max_wait_steps > 1);
+                }
+                prev_urc_first = urc_first;
+        }
+        assert(urc_first == false);
+
+        assert(cat_reset_write_stats(&at) == CAT_STATUS_OK);
+        assert(cat_get_write_stats(&at, CAT_FSM_TYPE_ATCMD, &atcmd_stats) == CAT_STATUS_OK);
+        assert(atcmd_stats.writes == 0);
+        assert(atcmd_stats.max_wait_steps == 0);
+
+        return 0;
+}
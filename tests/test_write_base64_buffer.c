@@ -0,0 +1,199 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char write_results[256];
+static char ack_results[512];
+
+static uint8_t var[6];
+static size_t var_write_size[8];
+static int var_write_size_index;
+
+static uint8_t blob[48];
+static uint8_t wo[4];
+
+static char const *input_text;
+static size_t input_index;
+
+static int cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        strcat(write_results, " CMD:");
+        strncat(write_results, data, data_size);
+        return 0;
+}
+
+static int var_write(const struct cat_variable *var, size_t write_size)
+{
+        var_write_size[var_write_size_index++] = write_size;
+        return 0;
+}
+
+static struct cat_variable vars[] = {
+        {
+                .type = CAT_VAR_BUF_BASE64,
+                .data = var,
+                .data_size = sizeof(var),
+                .write = var_write
+        }
+};
+
+static struct cat_variable blob_vars[] = {
+        {
+                .name = "blob",
+                .type = CAT_VAR_BUF_BASE64,
+                .data = blob,
+                .data_size = sizeof(blob)
+        },
+        {
+                .type = CAT_VAR_BUF_BASE64,
+                .data = wo,
+                .data_size = sizeof(wo),
+                .access = CAT_VAR_ACCESS_WRITE_ONLY
+        }
+};
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+SET",
+                .write = cmd_write,
+
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0]),
+                .need_all_vars = true
+        },
+        {
+                .name = "+BLOB",
+
+                .var = blob_vars,
+                .var_num = sizeof(blob_vars) / sizeof(blob_vars[0])
+        }
+};
+
+static char buf[256];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(var_write_size, 0, sizeof(var_write_size));
+        var_write_size_index = 0;
+
+        memset(ack_results, 0, sizeof(ack_results));
+        memset(write_results, 0, sizeof(write_results));
+}
+
+static const char test_case_1[] = "\nAT+SET=AAEC\nAT+SET=+/+/+/+/\nAT+SET=YQ==\nAT+SET=YWI=\nAT+SET?\n";
+static const char test_case_2[] = "\nAT+SET=YQ=\nAT+SET=Y\nAT+SET=\nAT+SET=YQ==YQ==\nAT+SET=AAAAAAAAAA==\nAT+SET=YW*=\nAT+SET=YQ=a\nAT+SET=QR==\nAT+SET=YWJ=\n";
+static const char test_case_3[] = "\nAT+BLOB=yMnKy8zNzs/Q0dLT1NXW19jZ2tvc3d7f4OHi4+Tl5ufo6err7O3u7/Dx8vP09fb3,AAAA\nAT+BLOB?\nAT+BLOB=?\n";
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+        int i;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        prepare_input(test_case_1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\nOK\n\nOK\n\nOK\n\n+SET=YWK/+/+/\n\nOK\n") == 0);
+        assert(strcmp(write_results, " CMD:AAEC CMD:+/+/+/+/ CMD:YQ== CMD:YWI=") == 0);
+
+        assert(var_write_size[0] == 3);
+        assert(var_write_size[1] == 6);
+        assert(var_write_size[2] == 1);
+        assert(var_write_size[3] == 2);
+
+        assert(var[0] == 'a');
+        assert(var[1] == 'b');
+        assert(var[2] == 0xBF);
+
+        prepare_input(test_case_2);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n") == 0);
+        assert(strcmp(write_results, "") == 0);
+        assert(var_write_size_index == 0);
+
+        prepare_input(test_case_3);
+        while (cat_service(&at) != 0) {};
+
+        for (i = 0; i < sizeof(blob); i++)
+                assert(blob[i] == 200 + i);
+
+        assert(strcmp(ack_results, "\nOK\n\n+BLOB=yMnKy8zNzs/Q0dLT1NXW19jZ2tvc3d7f4OHi4+Tl5ufo6err7O3u7/Dx8vP09fb3,AAAAAA==\n\nOK\n\n+BLOB=<blob:BASE64[RW]>,<BASE64[WO]>\n\nOK\n") == 0);
+
+        return 0;
+}
@@ -0,0 +1,179 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char ack_results[256];
+
+static char const *input_text;
+static size_t input_index;
+
+static size_t write_limit;
+static size_t write_calls;
+
+static cat_return_state cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        return CAT_RETURN_STATE_OK;
+}
+
+static cat_return_state cmd_read(const struct cat_command *cmd, uint8_t *data, size_t *data_size, const size_t max_data_size)
+{
+        strcpy((char *)data, "+GET=value");
+        *data_size = strlen((char *)data);
+        return CAT_RETURN_STATE_DATA_OK;
+}
+
+static cat_return_state urc_read(const struct cat_command *cmd, uint8_t *data, size_t *data_size, const size_t max_data_size)
+{
+        strcpy((char *)data, "+URC=event");
+        *data_size = strlen((char *)data);
+        return CAT_RETURN_STATE_DATA_OK;
+}
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+SET",
+                .write = cmd_write
+        },
+        {
+                .name = "+GET",
+                .read = cmd_read
+        },
+};
+
+static struct cat_command urc_cmd = {
+        .name = "+URC",
+        .read = urc_read,
+        .only_test = false
+};
+
+static char buf[128];
+static char unsolicited_buf[64];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+        .unsolicited_buf = unsolicited_buf,
+        .unsolicited_buf_size = sizeof(unsolicited_buf)
+};
+
+static int write_char(char ch)
+{
+        assert(false);
+        return 0;
+}
+
+static size_t write_buf(const char *data, size_t len)
+{
+        size_t n = (len < write_limit) ? len : write_limit;
+
+        write_calls++;
+        strncat(ack_results, data, n);
+        return n;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char,
+        .write_buf = write_buf
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        write_calls = 0;
+        memset(ack_results, 0, sizeof(ack_results));
+}
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        write_limit = sizeof(ack_results);
+        prepare_input("\nAT+SET=1\nAT+GET?\n");
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\n+GET=value\n\nOK\n") == 0);
+        assert(write_calls == 9);
+
+        write_limit = 0;
+        prepare_input("AT+GET?\n");
+        while (input_index < strlen(input_text))
+                cat_service(&at);
+        cat_service(&at);
+        cat_service(&at);
+        assert(strcmp(ack_results, "") == 0);
+        assert(cat_is_busy(&at) == CAT_STATUS_BUSY);
+
+        write_limit = 3;
+        write_calls = 0;
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n+GET=value\n\nOK\n") == 0);
+        assert(write_calls > 6);
+
+        write_limit = sizeof(ack_results);
+        prepare_input("");
+        assert(cat_trigger_unsolicited_read(&at, &urc_cmd) == CAT_STATUS_OK);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n+URC=event\n") == 0);
+        assert(write_calls == 3);
+
+        return 0;
+}
@@ -0,0 +1,210 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char write_results[256];
+static char ack_results[256];
+
+static uint8_t event;
+static uint16_t act;
+static uint64_t mode;
+
+static char const *input_text;
+static size_t input_index;
+
+static const char* const event_names[] = {"recv", "closed", "pdpdeact"};
+static const char* const act_names[] = {"LTE", "NR", "WCDMA"};
+
+static uint16_t event_slots[8];
+
+static struct cat_enum event_keywords = {
+        .names = event_names,
+        .num = sizeof(event_names) / sizeof(event_names[0])
+};
+
+static const struct cat_enum act_keywords = {
+        .names = act_names,
+        .num = sizeof(act_names) / sizeof(act_names[0])
+};
+
+static int cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        char str[32];
+
+        sprintf(str, " %s:%d/%d", cmd->name, event, act);
+        strcat(write_results, str);
+        return 0;
+}
+
+static struct cat_variable vars[] = {
+        {
+                .name = "event",
+                .type = CAT_VAR_ENUM,
+                .data = &event,
+                .data_size = sizeof(event),
+                .keywords = &event_keywords
+        },
+        {
+                .type = CAT_VAR_ENUM,
+                .data = &act,
+                .data_size = sizeof(act),
+                .keywords = &act_keywords
+        }
+};
+
+static struct cat_variable mode_vars[] = {
+        {
+                .type = CAT_VAR_ENUM,
+                .data = &mode,
+                .data_size = sizeof(mode),
+                .keywords = &act_keywords
+        }
+};
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+URC",
+                .write = cmd_write,
+
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0]),
+                .need_all_vars = true
+        },
+        {
+                .name = "+SURC",
+                .write = cmd_write,
+
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0]),
+                .need_all_vars = true,
+                .stream_args = true
+        },
+        {
+                .name = "+MODE",
+                .var = mode_vars,
+                .var_num = sizeof(mode_vars) / sizeof(mode_vars[0])
+        }
+};
+
+static char buf[128];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(ack_results, 0, sizeof(ack_results));
+        memset(write_results, 0, sizeof(write_results));
+}
+
+static const char test_case_1[] = "\nAT+URC=recv,NR\nAT+URC= \"pdpdeact\",WCDMA\nAT+SURC=closed,\"LTE\"\n";
+static const char test_case_2[] = "\nAT+URC=foo,NR\nAT+URC=rec,NR\nAT+URC=recvx,LTE\nAT+URC=recv,lte\nAT+URC=\"\",NR\nAT+SURC=closed,NR5G\n";
+static const char test_case_3[] = "\nAT+URC?\nAT+URC=?\n";
+static const char test_case_4[] = "\nAT+MODE=WCDMA\nAT+MODE?\nAT+MODE=5G\n";
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+
+        cat_enum_hash_init(&event_keywords, event_slots, sizeof(event_slots) / sizeof(event_slots[0]));
+        assert(event_keywords.hash.slots == event_slots);
+        assert(event_keywords.hash.size == 8);
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        prepare_input(test_case_1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\nOK\n\nOK\n") == 0);
+        assert(strcmp(write_results, " +URC:0/1 +URC:2/2 +SURC:1/0") == 0);
+
+        prepare_input(test_case_2);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n") == 0);
+        assert(strcmp(write_results, "") == 0);
+
+        prepare_input(test_case_3);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n+URC=closed,LTE\n\nOK\n\n+URC=<event:ENUM[RW]>,<ENUM[RW]>\n\nOK\n") == 0);
+
+        prepare_input(test_case_4);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\n+MODE=WCDMA\n\nOK\n\nERROR\n") == 0);
+        assert(mode == 2);
+
+        return 0;
+}
@@ -0,0 +1,167 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char ack_results[256];
+
+static int16_t rssi;
+static int64_t lat;
+static int8_t level;
+
+static char const *input_text;
+static size_t input_index;
+
+static struct cat_variable vars[] = {
+        {
+                .name = "rssi",
+                .type = CAT_VAR_FIXED_DEC,
+                .data = &rssi,
+                .data_size = sizeof(rssi),
+                .scale = 1
+        },
+        {
+                .type = CAT_VAR_FIXED_DEC,
+                .data = &lat,
+                .data_size = sizeof(lat),
+                .scale = 6
+        },
+        {
+                .type = CAT_VAR_FIXED_DEC,
+                .data = &level,
+                .data_size = sizeof(level)
+        }
+};
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+SET",
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0]),
+                .need_all_vars = true
+        }
+};
+
+static char buf[128];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(ack_results, 0, sizeof(ack_results));
+}
+
+static const char test_case_1[] = "\nAT+SET=-85.5,31.230416,7\n";
+static const char test_case_2[] = "\nAT+SET=-0.05,-121.4737011,3.5\nAT+SET?\n";
+static const char test_case_3[] = "\nAT+SET=12,.5,5.\nAT+SET?\n";
+static const char test_case_4[] = "\nAT+SET=-,1,1\nAT+SET=1.2.3,1,1\nAT+SET=3276.8,1,1\nAT+SET=1,1,-128.5\nAT+SET=1-2,1,1\nAT+SET=1,9223372036854.775808,1\nAT+SET=1,1,x\n";
+static const char test_case_5[] = "\nAT+SET=3276.7,-9223372036854.775808,-128\nAT+SET?\nAT+SET=?\n";
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        prepare_input(test_case_1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n") == 0);
+        assert(rssi == -855);
+        assert(lat == 31230416);
+        assert(level == 7);
+
+        prepare_input(test_case_2);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\n+SET=-0.1,-121.473701,4\n\nOK\n") == 0);
+
+        prepare_input(test_case_3);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\n+SET=12.0,0.500000,5\n\nOK\n") == 0);
+
+        prepare_input(test_case_4);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n") == 0);
+
+        prepare_input(test_case_5);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\n+SET=3276.7,-9223372036854.775808,-128\n\nOK\n\n+SET=<rssi:FIXED[RW]>,<FIXED[RW]>,<FIXED[RW]>\n\nOK\n") == 0);
+        assert(lat == INT64_MIN);
+
+        return 0;
+}
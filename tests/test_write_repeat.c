@@ -0,0 +1,221 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char write_results[256];
+static char ack_results[256];
+
+static uint8_t mode;
+static struct cat_buf_view oper;
+static char oper_name[8];
+static uint8_t stat;
+
+static char const *input_text;
+static size_t input_index;
+
+static int cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        char str[32];
+
+        sprintf(str, " %s:%d/%zu", cmd->name, mode, args_num);
+        strcat(write_results, str);
+        return 0;
+}
+
+static int cmd_element(const struct cat_command *cmd, const size_t index)
+{
+        char str[32];
+
+        if (stat > 5)
+                return -1;
+
+        if (cmd->stream_args != false) {
+                sprintf(str, " [%zu]%s/%d", index, oper_name, stat);
+        } else {
+                sprintf(str, " [%zu]%.*s/%d", index, (int)oper.size, oper.data, stat);
+        }
+        strcat(write_results, str);
+        return 0;
+}
+
+static struct cat_variable vars[] = {
+        {
+                .name = "mode",
+                .type = CAT_VAR_UINT_DEC,
+                .data = &mode,
+                .data_size = sizeof(mode)
+        }
+};
+
+static struct cat_variable element_vars[] = {
+        {
+                .name = "oper",
+                .type = CAT_VAR_BUF_VIEW,
+                .data = &oper,
+                .data_size = sizeof(oper)
+        },
+        {
+                .name = "stat",
+                .type = CAT_VAR_UINT_DEC,
+                .data = &stat,
+                .data_size = sizeof(stat)
+        }
+};
+
+static struct cat_variable stream_element_vars[] = {
+        {
+                .name = "oper",
+                .type = CAT_VAR_BUF_STRING,
+                .data = oper_name,
+                .data_size = sizeof(oper_name)
+        },
+        {
+                .name = "stat",
+                .type = CAT_VAR_UINT_DEC,
+                .data = &stat,
+                .data_size = sizeof(stat)
+        }
+};
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+COPS",
+                .write = cmd_write,
+
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0]),
+                .repeat_var = element_vars,
+                .repeat_var_num = sizeof(element_vars) / sizeof(element_vars[0]),
+                .element = cmd_element
+        },
+        {
+                .name = "+SCOPS",
+                .write = cmd_write,
+
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0]),
+                .repeat_var = stream_element_vars,
+                .repeat_var_num = sizeof(stream_element_vars) / sizeof(stream_element_vars[0]),
+                .element = cmd_element,
+                .stream_args = true
+        },
+        {
+                .name = "+MODE",
+                .write = cmd_write,
+
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0])
+        }
+};
+
+static char buf[128];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(ack_results, 0, sizeof(ack_results));
+        memset(write_results, 0, sizeof(write_results));
+}
+
+static const char test_case_1[] = "\nAT+COPS=1\nAT+COPS=2,\"abc\",1,\"de\",2\nAT+SCOPS=3,\"x\",0,\"yz\",5,\"w\",4\n";
+static const char test_case_2[] = "\nAT+COPS=1,\"abc\"\nAT+COPS=1,\"abc\",1,\"de\"\nAT+COPS=1,\"abc\",9\nAT+SCOPS=2,\"x\",1,\"y\"\nAT+SCOPS=2,\"x\",1,\"y\",7\nAT+MODE=1,2\n";
+static const char test_case_3[] = "\nAT+COPS?\nAT+COPS=?\n";
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        prepare_input(test_case_1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\nOK\n\nOK\n") == 0);
+        assert(strcmp(write_results, " +COPS:1/1 [0]abc/1 [1]de/2 +COPS:2/5 [0]x/0 [1]yz/5 [2]w/4 +SCOPS:3/7") == 0);
+
+        prepare_input(test_case_2);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n") == 0);
+        assert(strcmp(write_results, " [0]abc/1 [0]x/1 [0]x/1") == 0);
+
+        prepare_input(test_case_3);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n+COPS=1\n\nOK\n\n+COPS=<mode:UINT8[RW]>\n\nOK\n") == 0);
+
+        return 0;
+}
@@ -0,0 +1,187 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char write_results[256];
+static char ack_results[256];
+
+static char act[8];
+static int16_t rssi;
+static int16_t rsrp;
+static int16_t snr;
+
+static char const *input_text;
+static size_t input_index;
+
+static int cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        char str[64];
+
+        sprintf(str, " %s:%s/%d/%d/%d", cmd->name, act, rssi, rsrp, snr);
+        strcat(write_results, str);
+        return 0;
+}
+
+static struct cat_variable vars[] = {
+        {
+                .name = "act",
+                .type = CAT_VAR_BUF_STRING,
+                .data = act,
+                .data_size = sizeof(act)
+        },
+        {
+                .type = CAT_VAR_SKIP,
+                .data_size = 9
+        },
+        {
+                .type = CAT_VAR_INT_DEC,
+                .data = &rssi,
+                .data_size = sizeof(rssi)
+        },
+        {
+                .type = CAT_VAR_SKIP
+        },
+        {
+                .type = CAT_VAR_INT_DEC,
+                .data = &rsrp,
+                .data_size = sizeof(rsrp)
+        },
+        {
+                .type = CAT_VAR_INT_DEC,
+                .data = &snr,
+                .data_size = sizeof(snr)
+        }
+};
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+CPSI",
+                .write = cmd_write,
+
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0]),
+                .need_all_vars = true
+        },
+        {
+                .name = "+SCPSI",
+                .write = cmd_write,
+
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0]),
+                .need_all_vars = true,
+                .stream_args = true
+        }
+};
+
+static char buf[256];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(ack_results, 0, sizeof(ack_results));
+        memset(write_results, 0, sizeof(write_results));
+}
+
+static const char test_case_1[] = "\nAT+CPSI=LTE,Online,460-00,0x1234,12345,100,EUTRAN-BAND3,1300,5,5,-85,-10,-55,12\n"
+                                  "AT+SCPSI=NR,Online,460-01,0x5678,54321,200,NR5G-BAND78,627264,20,20,-90,xyz,-60,7\n";
+static const char test_case_2[] = "\nAT+CPSI=LTE,a,b\nAT+SCPSI=LTE,1,2,3,4,5,6,7,8,9,-1\nAT+CPSI=LTE,1,2,3,4,5,6,7,8,9,-1,2,x,3\n";
+static const char test_case_3[] = "\nAT+CPSI?\nAT+CPSI=?\n";
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        prepare_input(test_case_1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\nOK\n") == 0);
+        assert(strcmp(write_results, " +CPSI:LTE/-85/-55/12 +SCPSI:NR/-90/-60/7") == 0);
+
+        prepare_input(test_case_2);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nERROR\n\nERROR\n\nERROR\n") == 0);
+        assert(strcmp(write_results, "") == 0);
+
+        prepare_input(test_case_3);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n+CPSI=\"LTE\",,,,,,,,,,-1,,-60,7\n\nOK\n\n+CPSI=<act:STRING[RW]>,<SKIP[RW]>,<INT16[RW]>,<SKIP[RW]>,<INT16[RW]>,<INT16[RW]>\n\nOK\n") == 0);
+
+        return 0;
+}
@@ -141,15 +141,15 @@ int main(int argc, char **argv)
         prepare_input(test_case_1);
         while (cat_service(&at) != 0) {};
 
-        assert(strcmp(ack_results, "\nERROR\n\nOK\n\nERROR\n\nOK\n\r\nOK\r\n") == 0);
-        assert(strcmp(write_results, " CMD:\"\\\"abcd\\\"\" CMD:\"1122334\" CMD:\"t\"") == 0);
+        assert(strcmp(ack_results, "\nOK\n\nOK\n\nERROR\n\nOK\n\r\nOK\r\n") == 0);
+        assert(strcmp(write_results, " CMD:0 CMD:\"\\\"abcd\\\"\" CMD:\"1122334\" CMD:\"t\"") == 0);
 
         assert(strcmp(var, "t") == 0);
 
-        assert(var_write_size[0] == 6);
-        assert(var_write_size[1] == 7);
-        assert(var_write_size[2] == 1);
-        assert(var_write_size[3] == 0);
+        assert(var_write_size[0] == 1);
+        assert(var_write_size[1] == 6);
+        assert(var_write_size[2] == 7);
+        assert(var_write_size[3] == 1);
 
         prepare_input(test_case_2);
         while (cat_service(&at) != 0) {};
@@ -0,0 +1,205 @@
+/*
+MIT License
+
+Copyright (c) 2019 Marcin Borowicz
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <assert.h>
+
+#include "../src/cat.h"
+
+static char write_results[256];
+static char ack_results[256];
+
+static struct cat_buf_view event;
+static struct cat_buf_view state;
+static uint8_t link_id;
+
+static char const *input_text;
+static size_t input_index;
+
+static int cmd_write(const struct cat_command *cmd, const uint8_t *data, const size_t data_size, const size_t args_num)
+{
+        char str[64];
+
+        /* slices are still valid in command handler */
+        sprintf(str, " CMD:%.*s/%d/%.*s", (int)event.size, event.data, link_id, (int)state.size, state.data);
+        strcat(write_results, str);
+        return 0;
+}
+
+static int view_write(const struct cat_variable *var, size_t write_size)
+{
+        struct cat_buf_view const *view = var->data;
+        char str[64];
+
+        assert(write_size == view->size);
+
+        sprintf(str, " %s:%.*s", var->name, (int)view->size, view->data);
+        strcat(write_results, str);
+        return 0;
+}
+
+static int event_read(const struct cat_variable *var)
+{
+        event.data = "a\"b";
+        event.size = 3;
+        return 0;
+}
+
+static struct cat_variable vars[] = {
+        {
+                .name = "event",
+                .type = CAT_VAR_BUF_VIEW,
+                .data = &event,
+                .data_size = sizeof(event),
+                .write = view_write,
+                .read = event_read
+        },
+        {
+                .type = CAT_VAR_UINT_DEC,
+                .data = &link_id,
+                .data_size = sizeof(link_id)
+        },
+        {
+                .name = "state",
+                .type = CAT_VAR_BUF_VIEW,
+                .data = &state,
+                .data_size = sizeof(state),
+                .write = view_write,
+                .access = CAT_VAR_ACCESS_WRITE_ONLY
+        }
+};
+
+static struct cat_command cmds[] = {
+        {
+                .name = "+URC",
+                .write = cmd_write,
+
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0]),
+                .need_all_vars = true
+        },
+        {
+                .name = "+SURC",
+
+                .var = vars,
+                .var_num = sizeof(vars) / sizeof(vars[0]),
+                .need_all_vars = true,
+                .stream_args = true
+        }
+};
+
+static char buf[128];
+
+static struct cat_command_group cmd_group = {
+        .cmd = cmds,
+        .cmd_num = sizeof(cmds) / sizeof(cmds[0]),
+};
+
+static struct cat_command_group *cmd_desc[] = {
+        &cmd_group
+};
+
+static struct cat_descriptor desc = {
+        .cmd_group = cmd_desc,
+        .cmd_group_num = sizeof(cmd_desc) / sizeof(cmd_desc[0]),
+
+        .buf = buf,
+        .buf_size = sizeof(buf),
+};
+
+static int write_char(char ch)
+{
+        char str[2];
+        str[0] = ch;
+        str[1] = 0;
+        strcat(ack_results, str);
+        return 1;
+}
+
+static int read_char(char *ch)
+{
+        if (input_index >= strlen(input_text))
+                return 0;
+
+        *ch = input_text[input_index];
+        input_index++;
+        return 1;
+}
+
+static struct cat_io_interface iface = {
+        .read = read_char,
+        .write = write_char
+};
+
+static void prepare_input(const char *text)
+{
+        input_text = text;
+        input_index = 0;
+
+        memset(ack_results, 0, sizeof(ack_results));
+        memset(write_results, 0, sizeof(write_results));
+}
+
+static const char test_case_1[] = "\nAT+URC=\"recv\",5,closed\nAT+URC= \"a\\\"b\",1,\"\"\n";
+static const char test_case_2[] = "\nAT+URC=,1,x\nAT+URC=\"abc\"x,1,y\nAT+URC=\"ab\\\nAT+URC=\"ab\\,1,x\nAT+URC=a\\qb,1,x\n";
+static const char test_case_3[] = "\nAT+URC?\nAT+URC=?\n";
+static const char test_case_4[] = "\nAT+SURC=\"pdpdeact\",3,\"x\\ny\"\n";
+
+int main(int argc, char **argv)
+{
+        struct cat_object at;
+
+        cat_init(&at, &desc, &iface, NULL);
+
+        prepare_input(test_case_1);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n\nOK\n") == 0);
+        assert(strcmp(write_results, " event:recv state:closed CMD:recv/5/closed event:a\\\"b state: CMD:a\\\"b/1/") == 0);
+
+        prepare_input(test_case_2);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nERROR\n\nERROR\n\nERROR\n\nERROR\n\nERROR\n") == 0);
+        assert(strcmp(write_results, "") == 0);
+
+        prepare_input(test_case_3);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\n+URC=\"a\\\"b\",1,\"\"\n\nOK\n\n+URC=<event:STRING[RW]>,<UINT8[RW]>,<state:STRING[WO]>\n\nOK\n") == 0);
+
+        prepare_input(test_case_4);
+        while (cat_service(&at) != 0) {};
+
+        assert(strcmp(ack_results, "\nOK\n") == 0);
+        assert(strcmp(write_results, " event:pdpdeact state:x\\ny") == 0);
+        assert(link_id == 3);
+
+        return 0;
+}
@@ -0,0 +1,36 @@
+# cat_generate_tables(<name> SPEC <spec.json> [OUTPUT_DIR <dir>])
+#
+# Generates <name>.c and <name>.h from command/variable specification using catgen.py
+# and sets <name>_SOURCES and <name>_INCLUDE_DIR variables in caller scope.
+
+find_program( CATGEN_PYTHON NAMES python3 python )
+set( CATGEN_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/catgen.py )
+
+function( cat_generate_tables name )
+    cmake_parse_arguments( CATGEN "" "SPEC;OUTPUT_DIR" "" ${ARGN} )
+
+    if( NOT CATGEN_PYTHON )
+        message( FATAL_ERROR "cat_generate_tables: python interpreter not found" )
+    endif( )
+    if( NOT CATGEN_SPEC )
+        message( FATAL_ERROR "cat_generate_tables: SPEC argument is required" )
+    endif( )
+    if( NOT CATGEN_OUTPUT_DIR )
+        set( CATGEN_OUTPUT_DIR ${CMAKE_CURRENT_BINARY_DIR}/catgen )
+    endif( )
+
+    get_filename_component( spec ${CATGEN_SPEC} ABSOLUTE )
+    set( out_c ${CATGEN_OUTPUT_DIR}/${name}.c )
+    set( out_h ${CATGEN_OUTPUT_DIR}/${name}.h )
+
+    file( MAKE_DIRECTORY ${CATGEN_OUTPUT_DIR} )
+    add_custom_command(
+        OUTPUT ${out_c} ${out_h}
+        COMMAND ${CATGEN_PYTHON} ${CATGEN_SCRIPT} ${spec} --output-c ${out_c} --output-h ${out_h}
+        DEPENDS ${spec} ${CATGEN_SCRIPT}
+        COMMENT "Generating cAT command tables ${name}"
+        VERBATIM )
+
+    set( ${name}_SOURCES ${out_c} ${out_h} PARENT_SCOPE )
+    set( ${name}_INCLUDE_DIR ${CATGEN_OUTPUT_DIR} PARENT_SCOPE )
+endfunction( )
@@ -0,0 +1,469 @@
+#!/usr/bin/env python3
+#
+# MIT License
+#
+# catgen - offline cAT command tables compiler.
+#
+# Reads JSON command/variable specification and emits C source and header
+# with const command tables, flattened commands index, command names trie,
+# commands names hash table and precomputed test (=?) responses.
+# Generated descriptor has tables_prebuilt flag set, so cat_init only uses
+# the tables and all of them can be placed in read-only memory.
+#
+# Specification format:
+#
+# {
+#     "prefix": "app",                       C symbols prefix
+#     "includes": ["app_handlers.h"],        headers with handlers and variables declarations
+#     "buf_size": 256,                       working buffer length
+#     "unsolicited_buf_size": 128,           optional unsolicited working buffer length
+#     "atcmd_buf2_size": 256,                optional second atcmd working buffer length
+#     "hold_timeout_ms": 5000,               optional default hold state timeout
+#     "char_timeout_ms": 1000,               optional inter-char timeout
+#     "groups": [
+#         {
+#             "name": "standard",
+#             "disable": false,
+#             "commands": [
+#                 {
+#                     "name": "+PRINT",
+#                     "description": "Printing something special at (X,Y).",
+#                     "write": "print_write", "read": null, "run": "print_run", "test": null,
+#                     "need_all_vars": true, "only_test": false, "disable": false, "implicit_write": false,
+#                     "stream_args": false, "capture_ring": null, "capture_var": 0,
+#                     "hold_timeout_ms": 30000, "element": null, "repeat_vars": [],
+#                     "vars": [
+#                         {
+#                             "name": "X", "type": "UINT_DEC", "data": "&x", "size": 1, "access": "RW",
+#                             "write": "x_write", "read": null, "chunk": null
+#                         }
+#                     ]
+#                 }
+#             ]
+#         }
+#     ]
+# }
+#
+# Variable "type" is cat_var_type name without CAT_VAR_ prefix, "access" is one of RW, RO, WO.
+# Variable "size" may be C expression (e.g. "sizeof(msg)") for buffer types only.
+# SKIP variable needs neither "data" nor "size" ("size" is number of skipped fields, 1 by default).
+# FIXED_DEC variable has optional "scale" (number of fraction digits, 0 - 18).
+# ENUM variable requires "keywords" list (e.g. ["LTE", "NR"]), keywords hash table is generated with it.
+# Optional "repeat_vars" have the same format as "vars" and are written in cycle after "vars",
+# "element" handler is called after each complete repeated element.
+
+import argparse
+import json
+import os
+import re
+import sys
+
+VAR_TYPES = {
+    'INT_DEC': {1: 'INT8', 2: 'INT16', 4: 'INT32', 8: 'INT64'},
+    'UINT_DEC': {1: 'UINT8', 2: 'UINT16', 4: 'UINT32', 8: 'UINT64'},
+    'NUM_HEX': {1: 'HEX8', 2: 'HEX16', 4: 'HEX32', 8: 'HEX64'},
+    'BUF_HEX': 'HEXBUF',
+    'BUF_STRING': 'STRING',
+    'BUF_BASE64': 'BASE64',
+    'BUF_VIEW': 'STRING',
+    'SKIP': 'SKIP',
+    'ENUM': 'ENUM',
+    'FIXED_DEC': {1: 'FIXED', 2: 'FIXED', 4: 'FIXED', 8: 'FIXED'},
+}
+
+VAR_ACCESS = {
+    'RW': 'CAT_VAR_ACCESS_READ_WRITE',
+    'RO': 'CAT_VAR_ACCESS_READ_ONLY',
+    'WO': 'CAT_VAR_ACCESS_WRITE_ONLY',
+}
+
+CMD_NAME_CHARS = re.compile(r'^[A-Za-z0-9+#$@_%&]+$')
+
+HASH_MAX_SEEDS = 4096
+
+
+class SpecError(Exception):
+    pass
+
+
+def c_string(text):
+    out = ['"']
+    for ch in text:
+        if ch == '\\':
+            out.append('\\\\')
+        elif ch == '"':
+            out.append('\\"')
+        elif ch == '\n':
+            out.append('\\n')
+        elif ch == '\r':
+            out.append('\\r')
+        elif ord(ch) < 0x20 or ord(ch) > 0x7E:
+            out.append('\\%03o' % ord(ch))
+        else:
+            out.append(ch)
+    out.append('"')
+    return ''.join(out)
+
+
+def c_ident(text):
+    ident = re.sub(r'[^A-Za-z0-9_]', '_', text.strip('+#$@%&'))
+    if not ident or ident[0].isdigit():
+        ident = '_' + ident
+    return ident
+
+
+def to_upper(name):
+    # same as parser to_upper (only ascii lower case letters)
+    return bytes(ch - 32 if 0x61 <= ch <= 0x7A else ch for ch in name.encode('ascii'))
+
+
+def hash_name(name, seed):
+    # 32-bit FNV-1a, offset basis xored with seed (same as parser hash_name)
+    h = 2166136261 ^ seed
+    for ch in name.encode('ascii'):
+        h ^= ch
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def format_test_args(cmd):
+    args = []
+    for var in cmd['vars']:
+        kind = VAR_TYPES[var['type']]
+        if isinstance(kind, dict):
+            type_name = kind[var['size']]
+        else:
+            type_name = kind
+        name = var['name'] + ':' if var.get('name') is not None else ''
+        args.append('<%s%s[%s]>' % (name, type_name, var['access']))
+    return ','.join(args)
+
+
+def validate(spec):
+    if not re.match(r'^[A-Za-z_][A-Za-z0-9_]*$', spec.get('prefix', '')):
+        raise SpecError('invalid or missing prefix')
+    if not isinstance(spec.get('buf_size'), int) or spec['buf_size'] <= 0:
+        raise SpecError('invalid or missing buf_size')
+    for timeout in ('hold_timeout_ms', 'char_timeout_ms'):
+        if not isinstance(spec.get(timeout, 0), int) or spec.get(timeout, 0) < 0:
+            raise SpecError('invalid %s' % timeout)
+    if not spec.get('groups'):
+        raise SpecError('at least one command group is required')
+
+    for group in spec['groups']:
+        if not group.get('commands'):
+            raise SpecError('group %r has no commands' % group.get('name'))
+        for cmd in group['commands']:
+            name = cmd.get('name')
+            if not name or not CMD_NAME_CHARS.match(name):
+                raise SpecError('invalid command name %r' % name)
+            cmd.setdefault('vars', [])
+            cmd.setdefault('repeat_vars', [])
+            if not isinstance(cmd.get('hold_timeout_ms', 0), int) or cmd.get('hold_timeout_ms', 0) < 0:
+                raise SpecError('%s: invalid hold_timeout_ms' % name)
+            if cmd.get('implicit_write') and (cmd.get('read') or cmd.get('run') or cmd.get('test')):
+                raise SpecError('implicit write command %s may only have write handler' % name)
+            if cmd.get('element') and not cmd['repeat_vars']:
+                raise SpecError('%s: element handler requires repeat_vars' % name)
+            for var in cmd['vars'] + cmd['repeat_vars']:
+                var.setdefault('access', 'RW')
+                if var.get('type') == 'SKIP':
+                    var.setdefault('data', 'NULL')
+                    var.setdefault('size', 1)
+                if var.get('type') not in VAR_TYPES:
+                    raise SpecError('%s: unknown variable type %r' % (name, var.get('type')))
+                if var['access'] not in VAR_ACCESS:
+                    raise SpecError('%s: unknown variable access %r' % (name, var['access']))
+                if 'data' not in var or 'size' not in var:
+                    raise SpecError('%s: variable requires data and size' % name)
+                if isinstance(VAR_TYPES[var['type']], dict) and var['size'] not in VAR_TYPES[var['type']]:
+                    raise SpecError('%s: invalid size %r of %s variable' % (name, var['size'], var['type']))
+                if var['type'] == 'FIXED_DEC' and (not isinstance(var.get('scale', 0), int) or not 0 <= var.get('scale', 0) <= 18):
+                    raise SpecError('%s: invalid scale %r of FIXED_DEC variable' % (name, var.get('scale')))
+                if var['type'] == 'ENUM':
+                    keywords = var.get('keywords')
+                    if var['size'] not in (1, 2, 4, 8):
+                        raise SpecError('%s: invalid size %r of ENUM variable' % (name, var['size']))
+                    if not keywords or not all(isinstance(k, str) and k for k in keywords) or len(set(keywords)) != len(keywords):
+                        raise SpecError('%s: ENUM variable requires list of unique keywords' % name)
+            if cmd.get('capture_ring'):
+                index = cmd.get('capture_var', 0)
+                if not isinstance(index, int) or not 0 <= index < len(cmd['vars']):
+                    raise SpecError('%s: invalid capture_var' % name)
+                if cmd['vars'][index]['type'] not in ('UINT_DEC', 'NUM_HEX'):
+                    raise SpecError('%s: capture_var has to be UINT_DEC or NUM_HEX variable' % name)
+                if cmd['vars'][index]['access'] == 'RO':
+                    raise SpecError('%s: capture_var has to be writable variable' % name)
+
+
+def build_trie(names):
+    order = sorted(range(len(names)), key=lambda i: to_upper(names[i]))
+
+    # node: [child, sibling, begin, end, ch]
+    trie = [[0, 0, 0, len(names), 0]]
+    for pos, index in enumerate(order):
+        node = 0
+        for ch in to_upper(names[index]):
+            prev = 0
+            child = trie[node][0]
+            while child != 0 and trie[child][4] != ch:
+                prev = child
+                child = trie[child][1]
+            if child == 0:
+                child = len(trie)
+                trie.append([0, 0, pos, pos, ch])
+                if prev == 0:
+                    trie[node][0] = child
+                else:
+                    trie[prev][1] = child
+            trie[child][3] = pos + 1
+            node = child
+
+    if len(trie) > 0xFFFF:
+        raise SpecError('too many trie nodes')
+    return trie, order
+
+
+def build_hash(names):
+    size = 1
+    while size < 2 * len(names):
+        size <<= 1
+
+    best = None
+    for seed in range(HASH_MAX_SEEDS):
+        slots = [0] * size
+        displacement = 0
+        for index, name in enumerate(names):
+            slot = hash_name(name, seed) & (size - 1)
+            while slots[slot] != 0:
+                slot = (slot + 1) & (size - 1)
+                displacement += 1
+            slots[slot] = index + 1
+        if best is None or displacement < best[0]:
+            best = (displacement, seed, slots)
+        if displacement == 0:
+            break
+
+    return best[1], best[2]
+
+
+def emit_handler(field, value):
+    return '        .%-14s = %s,\n' % (field, value if value else 'NULL')
+
+
+def emit_vars(c, prefix, table, vars):
+    for var_index, var in enumerate(vars):
+        if var['type'] != 'ENUM':
+            continue
+        enum = '%s_enum_%s_%d' % (prefix, table, var_index)
+        enum_seed, enum_slots = build_hash(var['keywords'])
+        c.append('static const char* const %s_names[] = {%s};\n' % (enum, ', '.join(c_string(k) for k in var['keywords'])))
+        c.append('static const uint16_t %s_slots[] = {%s};\n' % (enum, ', '.join(str(i) for i in enum_slots)))
+        c.append('static const struct cat_enum %s = {\n' % enum)
+        c.append('    .names = %s_names,\n' % enum)
+        c.append('    .num   = sizeof(%s_names) / sizeof(%s_names[0]),\n' % (enum, enum))
+        c.append('    .hash  = {\n')
+        c.append('        .slots = %s_slots,\n' % enum)
+        c.append('        .size  = sizeof(%s_slots) / sizeof(%s_slots[0]),\n' % (enum, enum))
+        c.append('        .seed  = %dU,\n' % enum_seed)
+        c.append('    },\n')
+        c.append('};\n\n')
+    c.append('static const struct cat_variable %s_%s[] = {\n' % (prefix, table))
+    for var_index, var in enumerate(vars):
+        c.append('    {\n')
+        c.append('        .name      = %s,\n' % (c_string(var['name']) if var.get('name') is not None else 'NULL'))
+        c.append('        .type      = CAT_VAR_%s,\n' % var['type'])
+        c.append('        .data      = %s,\n' % var['data'])
+        c.append('        .data_size = %s,\n' % var['size'])
+        c.append('        .access    = %s,\n' % VAR_ACCESS[var['access']])
+        c.append('        .write     = %s,\n' % (var.get('write') or 'NULL'))
+        c.append('        .read      = %s,\n' % (var.get('read') or 'NULL'))
+        if var.get('chunk'):
+            c.append('        .chunk     = %s,\n' % var['chunk'])
+        if var['type'] == 'ENUM':
+            c.append('        .keywords  = &%s_enum_%s_%d,\n' % (prefix, table, var_index))
+        if var.get('scale'):
+            c.append('        .scale     = %dU,\n' % var['scale'])
+        c.append('    },\n')
+    c.append('};\n\n')
+
+
+def generate(spec, spec_name, header_name):
+    prefix = spec['prefix']
+
+    cmds = []
+    for group_index, group in enumerate(spec['groups']):
+        for cmd in group['commands']:
+            cmds.append((group_index, cmd))
+    if len(cmds) > 0xFFFF:
+        raise SpecError('too many commands')
+
+    names = [cmd['name'] for _, cmd in cmds]
+    trie, order = build_trie(names)
+    seed, slots = build_hash(names)
+
+    macros = {}
+    for index, name in enumerate(names):
+        macro = '%s_CMD_%s' % (prefix.upper(), c_ident(name).upper())
+        if macro not in macros:
+            macros[macro] = index
+
+    banner = '/* generated by catgen.py from %s - do not edit */\n' % spec_name
+
+    h = [banner, '\n']
+    guard = c_ident(header_name).upper()
+    h.append('#ifndef %s\n#define %s\n\n' % (guard, guard))
+    h.append('#include "cat.h"\n\n')
+    h.append('#ifdef __cplusplus\nextern "C"\n{\n#endif\n\n')
+    h.append('#define %s_COMMANDS_NUM (%dU)\n\n' % (prefix.upper(), len(cmds)))
+    for macro, index in macros.items():
+        h.append('#define %s (&%s_cmds[%d])\n' % (macro, prefix, index))
+    h.append('\n')
+    h.append('extern const struct cat_command %s_cmds[%s_COMMANDS_NUM];\n' % (prefix, prefix.upper()))
+    for group_index, group in enumerate(spec['groups']):
+        h.append('extern struct cat_command_group %s_group_%d; /* %s */\n' % (prefix, group_index, group.get('name') or ''))
+    h.append('extern const struct cat_descriptor %s_desc;\n\n' % prefix)
+    h.append('#ifdef __cplusplus\n}\n#endif\n\n')
+    h.append('#endif /* %s */\n' % guard)
+
+    c = [banner, '\n']
+    c.append('#include "%s"\n' % header_name)
+    for include in spec.get('includes', []):
+        c.append('#include "%s"\n' % include)
+    c.append('\n')
+
+    c.append('static uint8_t %s_buf[%d];\n' % (prefix, spec['buf_size']))
+    if spec.get('unsolicited_buf_size'):
+        c.append('static uint8_t %s_unsolicited_buf[%d];\n' % (prefix, spec['unsolicited_buf_size']))
+    if spec.get('atcmd_buf2_size'):
+        c.append('static uint8_t %s_atcmd_buf2[%d];\n' % (prefix, spec['atcmd_buf2_size']))
+    c.append('\n')
+
+    for index, (_, cmd) in enumerate(cmds):
+        if cmd['vars']:
+            emit_vars(c, prefix, 'vars_%d' % index, cmd['vars'])
+        if cmd['repeat_vars']:
+            emit_vars(c, prefix, 'repeat_vars_%d' % index, cmd['repeat_vars'])
+
+    c.append('const struct cat_command %s_cmds[%s_COMMANDS_NUM] = {\n' % (prefix, prefix.upper()))
+    for index, (_, cmd) in enumerate(cmds):
+        c.append('    {\n')
+        c.append('        .%-14s = %s,\n' % ('name', c_string(cmd['name'])))
+        if cmd.get('description') is not None:
+            c.append('        .%-14s = %s,\n' % ('description', c_string(cmd['description'])))
+        for handler in ('write', 'read', 'run', 'test'):
+            c.append(emit_handler(handler, cmd.get(handler)))
+        if cmd['vars']:
+            c.append('        .%-14s = %s_vars_%d,\n' % ('var', prefix, index))
+            c.append('        .%-14s = %d,\n' % ('var_num', len(cmd['vars'])))
+            c.append('        .%-14s = %s,\n' % ('test_args', c_string(format_test_args(cmd))))
+        if cmd['repeat_vars']:
+            c.append('        .%-14s = %s_repeat_vars_%d,\n' % ('repeat_var', prefix, index))
+            c.append('        .%-14s = %d,\n' % ('repeat_var_num', len(cmd['repeat_vars'])))
+            c.append(emit_handler('element', cmd.get('element')))
+        for flag in ('need_all_vars', 'only_test', 'disable', 'implicit_write', 'stream_args'):
+            c.append('        .%-14s = %s,\n' % (flag, 'true' if cmd.get(flag) else 'false'))
+        if cmd.get('hold_timeout_ms'):
+            c.append('        .hold_timeout_ms = %dU,\n' % cmd['hold_timeout_ms'])
+        if cmd.get('capture_ring'):
+            c.append('        .%-14s = %s,\n' % ('capture_ring', cmd['capture_ring']))
+            c.append('        .%-14s = %d,\n' % ('capture_var', cmd.get('capture_var', 0)))
+        c.append('    },\n')
+    c.append('};\n\n')
+
+    first = 0
+    for group_index, group in enumerate(spec['groups']):
+        c.append('struct cat_command_group %s_group_%d = {\n' % (prefix, group_index))
+        c.append('    .name    = %s,\n' % (c_string(group['name']) if group.get('name') is not None else 'NULL'))
+        c.append('    .cmd     = &%s_cmds[%d],\n' % (prefix, first))
+        c.append('    .cmd_num = %d,\n' % len(group['commands']))
+        c.append('    .disable = %s,\n' % ('true' if group.get('disable') else 'false'))
+        c.append('};\n\n')
+        first += len(group['commands'])
+
+    c.append('static struct cat_command_group* const %s_groups[] = {\n' % prefix)
+    for group_index, _ in enumerate(spec['groups']):
+        c.append('    &%s_group_%d,\n' % (prefix, group_index))
+    c.append('};\n\n')
+
+    c.append('static const struct cat_command_index %s_cmd_index[%s_COMMANDS_NUM] = {\n' % (prefix, prefix.upper()))
+    for index, (group_index, _) in enumerate(cmds):
+        c.append('    {&%s_cmds[%d], %d},\n' % (prefix, index, group_index))
+    c.append('};\n\n')
+
+    c.append('static const uint16_t %s_trie_order[%s_COMMANDS_NUM] = {\n' % (prefix, prefix.upper()))
+    for pos in range(0, len(order), 16):
+        c.append('    %s,\n' % ', '.join(str(i) for i in order[pos:pos + 16]))
+    c.append('};\n\n')
+
+    c.append('static const struct cat_trie_node %s_trie[%d] = {\n' % (prefix, len(trie)))
+    for child, sibling, begin, end, ch in trie:
+        c.append("    {%d, %d, %d, %d, %s},\n" % (child, sibling, begin, end, "'%c'" % ch if ch else "'\\0'"))
+    c.append('};\n\n')
+
+    c.append('static const uint16_t %s_cmd_hash_slots[%d] = {\n' % (prefix, len(slots)))
+    for pos in range(0, len(slots), 16):
+        c.append('    %s,\n' % ', '.join(str(i) for i in slots[pos:pos + 16]))
+    c.append('};\n\n')
+
+    c.append('const struct cat_descriptor %s_desc = {\n' % prefix)
+    c.append('    .cmd_group     = %s_groups,\n' % prefix)
+    c.append('    .cmd_group_num = sizeof(%s_groups) / sizeof(%s_groups[0]),\n\n' % (prefix, prefix))
+    c.append('    .buf      = %s_buf,\n' % prefix)
+    c.append('    .buf_size = sizeof(%s_buf),\n\n' % prefix)
+    if spec.get('unsolicited_buf_size'):
+        c.append('    .unsolicited_buf      = %s_unsolicited_buf,\n' % prefix)
+        c.append('    .unsolicited_buf_size = sizeof(%s_unsolicited_buf),\n\n' % prefix)
+    if spec.get('atcmd_buf2_size'):
+        c.append('    .atcmd_buf2      = %s_atcmd_buf2,\n' % prefix)
+        c.append('    .atcmd_buf2_size = sizeof(%s_atcmd_buf2),\n\n' % prefix)
+    c.append('    .trie_size           = sizeof(%s_trie) / sizeof(%s_trie[0]),\n' % (prefix, prefix))
+    c.append('    .prebuilt_trie       = %s_trie,\n' % prefix)
+    c.append('    .prebuilt_trie_order = %s_trie_order,\n\n' % prefix)
+    c.append('    .prebuilt_cmd_index = %s_cmd_index,\n\n' % prefix)
+    c.append('    .cmd_hash = {\n')
+    c.append('        .slots = %s_cmd_hash_slots,\n' % prefix)
+    c.append('        .size  = sizeof(%s_cmd_hash_slots) / sizeof(%s_cmd_hash_slots[0]),\n' % (prefix, prefix))
+    c.append('        .seed  = %dU,\n' % seed)
+    c.append('    },\n\n')
+    c.append('    .tables_prebuilt = true,\n')
+    for timeout in ('hold_timeout_ms', 'char_timeout_ms'):
+        if spec.get(timeout):
+            c.append('    .%s = %dU,\n' % (timeout, spec[timeout]))
+    c.append('};\n')
+
+    return ''.join(c), ''.join(h)
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path, 'r') as f:
+            if f.read() == text:
+                return
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='cAT offline command tables compiler')
+    parser.add_argument('spec', help='JSON command/variable specification')
+    parser.add_argument('--output-c', required=True, help='generated C source path')
+    parser.add_argument('--output-h', required=True, help='generated C header path')
+    args = parser.parse_args()
+
+    try:
+        with open(args.spec, 'r') as f:
+            spec = json.load(f)
+        validate(spec)
+        source, header = generate(spec, os.path.basename(args.spec), os.path.basename(args.output_h))
+    except (OSError, ValueError, SpecError) as e:
+        sys.stderr.write('catgen: %s: %s\n' % (args.spec, e))
+        return 1
+
+    write_if_changed(args.output_c, source)
+    write_if_changed(args.output_h, header)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())